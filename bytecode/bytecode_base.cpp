@@ -616,6 +616,7 @@ Error GDScriptDecomp::decompile_buffer(Vector<uint8_t> p_buffer) {
 #endif
 	//Cleanup
 	script_text = String();
+	error_message = String();
 
 	ScriptState state;
 	//Load bytecode
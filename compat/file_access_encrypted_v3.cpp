@@ -34,6 +34,8 @@
 #include "core/string/print_string.h"
 #include "core/variant/variant.h"
 
+#include "utility/aes_engine.h"
+
 #include <stdio.h>
 
 Error FileAccessEncryptedv3::open_and_parse(Ref<FileAccess> p_base, const Vector<uint8_t> &p_key, Mode p_mode, bool p_with_magic) {
@@ -75,19 +77,13 @@ Error FileAccessEncryptedv3::open_and_parse(Ref<FileAccess> p_base, const Vector
 		uint64_t blen = p_base->get_buffer(data.ptrw(), ds);
 		ERR_FAIL_COND_V(blen != ds, ERR_FILE_CORRUPT);
 
-		CryptoCore::AESContext ctx;
-		ctx.set_decode_key(key.ptrw(), 256);
-
-		for (uint64_t i = 0; i < ds; i += 16) {
-			ctx.decrypt_ecb(&data.write[i], &data.write[i]);
-		}
+		unsigned char hash[16];
+		Error err = AESEngine::decrypt_ecb256(key, data.ptrw(), ds, length, hash);
+		ERR_FAIL_COND_V(err != OK, err);
 
 		data.resize(length);
 
-		unsigned char hash[16];
-		ERR_FAIL_COND_V(CryptoCore::md5(data.ptr(), data.size(), hash) != OK, ERR_BUG);
-
-		ERR_FAIL_COND_V_MSG(String::md5(hash) != String::md5(md5d), ERR_FILE_CORRUPT, "The MD5 sum of the decrypted file does not match the expected value. It could be that the file is corrupt, or that the provided decryption key is invalid.");
+		ERR_FAIL_COND_V_MSG(memcmp(hash, md5d, 16) != 0, ERR_FILE_CORRUPT, "The MD5 sum of the decrypted file does not match the expected value. It could be that the file is corrupt, or that the provided decryption key is invalid.");
 
 		file = p_base;
 	}
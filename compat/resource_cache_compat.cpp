@@ -0,0 +1,134 @@
+#include "resource_cache_compat.h"
+
+Mutex ResourceCacheCompat::mutex;
+List<ResourceCacheCompat::Entry> ResourceCacheCompat::lru;
+HashMap<String, List<ResourceCacheCompat::Entry>::Element *> ResourceCacheCompat::entries;
+std::atomic<int64_t> ResourceCacheCompat::max_size = 0;
+int64_t ResourceCacheCompat::total_size = 0;
+uint64_t ResourceCacheCompat::generation = 0;
+uint64_t ResourceCacheCompat::hits = 0;
+uint64_t ResourceCacheCompat::misses = 0;
+uint64_t ResourceCacheCompat::evictions = 0;
+thread_local int ResourceCacheCompat::bypass_depth = 0;
+
+ResourceCacheCompat::Bypass::Bypass(bool p_active) :
+		active(p_active) {
+	if (active) {
+		bypass_depth++;
+	}
+}
+
+ResourceCacheCompat::Bypass::~Bypass() {
+	if (active) {
+		bypass_depth--;
+	}
+}
+
+String ResourceCacheCompat::_get_key(const String &p_path, ResourceInfo::LoadType p_type, uint64_t p_generation) {
+	return itos(p_generation) + ":" + itos(p_type) + ":" + p_path;
+}
+
+void ResourceCacheCompat::_evict_to(int64_t p_size) {
+	while (total_size > p_size && lru.size() > 0) {
+		auto *E = lru.back();
+		total_size -= E->get().size;
+		entries.erase(E->get().key);
+		lru.erase(E);
+		evictions++;
+	}
+}
+
+bool ResourceCacheCompat::is_enabled() {
+	return max_size > 0 && bypass_depth == 0;
+}
+
+Ref<Resource> ResourceCacheCompat::get(const String &p_path, ResourceInfo::LoadType p_type, uint64_t *r_generation) {
+	if (!is_enabled()) {
+		return Ref<Resource>();
+	}
+	MutexLock lock(mutex);
+	if (r_generation) {
+		*r_generation = generation;
+	}
+	auto *E = entries.getptr(_get_key(p_path, p_type, generation));
+	if (!E) {
+		misses++;
+		return Ref<Resource>();
+	}
+	hits++;
+	lru.move_to_front(*E);
+	return (*E)->get().res;
+}
+
+void ResourceCacheCompat::put(const String &p_path, ResourceInfo::LoadType p_type, const Ref<Resource> &p_res, int64_t p_estimated_size, uint64_t p_generation) {
+	if (!is_enabled() || p_res.is_null()) {
+		return;
+	}
+	MutexLock lock(mutex);
+	// loaded from packs that have been unloaded since
+	if (p_generation != generation) {
+		return;
+	}
+	// don't let a single resource flush the whole cache
+	if (p_estimated_size > max_size / 2) {
+		return;
+	}
+	String key = _get_key(p_path, p_type, generation);
+	auto *E = entries.getptr(key);
+	if (E) {
+		// another thread loaded it at the same time
+		lru.move_to_front(*E);
+		return;
+	}
+	_evict_to(max_size - p_estimated_size);
+	lru.push_front({ key, p_res, p_estimated_size });
+	entries.insert(key, lru.front());
+	total_size += p_estimated_size;
+}
+
+void ResourceCacheCompat::clear() {
+	MutexLock lock(mutex);
+	generation++;
+	lru.clear();
+	entries.clear();
+	total_size = 0;
+}
+
+uint64_t ResourceCacheCompat::get_generation() {
+	MutexLock lock(mutex);
+	return generation;
+}
+
+void ResourceCacheCompat::set_max_size(int64_t p_bytes) {
+	MutexLock lock(mutex);
+	max_size = MAX(p_bytes, (int64_t)0);
+	_evict_to(max_size);
+}
+
+int64_t ResourceCacheCompat::get_max_size() {
+	return max_size.load();
+}
+
+int64_t ResourceCacheCompat::get_total_size() {
+	MutexLock lock(mutex);
+	return total_size;
+}
+
+Dictionary ResourceCacheCompat::get_stats() {
+	MutexLock lock(mutex);
+	Dictionary stats;
+	stats["hits"] = hits;
+	stats["misses"] = misses;
+	stats["evictions"] = evictions;
+	stats["entries"] = entries.size();
+	stats["total_size"] = total_size;
+	stats["max_size"] = max_size.load();
+	return stats;
+}
+
+void ResourceCacheCompat::reset_stats() {
+	MutexLock lock(mutex);
+	hits = 0;
+	misses = 0;
+	evictions = 0;
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "core/io/resource.h"
+#include "core/os/mutex.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/list.h"
+#include "core/variant/dictionary.h"
+
+#include "utility/resource_info.h"
+
+#include <atomic>
+
+// Size-bounded LRU cache for resources loaded by ResourceCompatLoader::fake_load() and non_global_load().
+// Those loads bypass Godot's ResourceCache, so without this the same resource would be re-parsed by every exporter that needs it.
+// Disabled (max size 0) unless explicitly enabled, e.g. for the duration of ImportExporter::export_imports().
+class ResourceCacheCompat {
+	struct Entry {
+		String key;
+		Ref<Resource> res;
+		int64_t size = 0;
+	};
+
+	static Mutex mutex;
+	// front is the most recently used
+	static List<Entry> lru;
+	static HashMap<String, List<Entry>::Element *> entries;
+	// read without the lock by is_enabled()
+	static std::atomic<int64_t> max_size;
+	static int64_t total_size;
+	static uint64_t generation;
+	static uint64_t hits;
+	static uint64_t misses;
+	static uint64_t evictions;
+	static thread_local int bypass_depth;
+
+	static String _get_key(const String &p_path, ResourceInfo::LoadType p_type, uint64_t p_generation);
+	static void _evict_to(int64_t p_size);
+
+public:
+	// Disables the cache on the current thread while in scope; used for exporters that modify the resources they load.
+	struct Bypass {
+		bool active;
+		Bypass(bool p_active = true);
+		~Bypass();
+	};
+
+	static bool is_enabled();
+	// `r_generation` is set to the cache generation at lookup time; pass it to put() once the resource has been loaded.
+	static Ref<Resource> get(const String &p_path, ResourceInfo::LoadType p_type, uint64_t *r_generation = nullptr);
+	// Dropped if the cache was cleared since `p_generation` was obtained, so a load that started before clear() is never cached.
+	static void put(const String &p_path, ResourceInfo::LoadType p_type, const Ref<Resource> &p_res, int64_t p_estimated_size, uint64_t p_generation);
+	// Drops all the entries and invalidates any loads still in flight; call whenever the loaded packs change.
+	static void clear();
+	static uint64_t get_generation();
+	static void set_max_size(int64_t p_bytes);
+	static int64_t get_max_size();
+	static int64_t get_total_size();
+	static Dictionary get_stats();
+	static void reset_stats();
+};
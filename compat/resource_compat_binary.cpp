@@ -35,6 +35,7 @@
 #include "core/error/error_macros.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access_compressed.h"
+#include "core/io/marshalls.h"
 #include "core/io/missing_resource.h"
 #include "core/io/resource.h"
 #include "core/version.h"
@@ -726,6 +727,46 @@ Ref<Resource> ResourceLoaderCompatBinary::get_resource() {
 	return resource;
 }
 
+Error ResourceLoaderCompatBinary::stream_properties(const PropertyStreamFunc &p_callback) {
+	ERR_FAIL_COND_V(error != OK, error);
+	// References to internal resources resolve to null rather than warning about the empty cache
+	for (int i = 0; i < internal_resources.size(); i++) {
+		internal_index_cache[using_named_scene_ids ? internal_resources[i].path : res_path + "::" + itos(i)] = Ref<Resource>();
+	}
+	for (int i = 0; i < internal_resources.size(); i++) {
+		f->seek(internal_resources[i].offset);
+		String t = get_unicode_string();
+		int pc = f->get_32();
+		for (int j = 0; j < pc; j++) {
+			StringName name = _get_string();
+			if (name == StringName()) {
+				error = ERR_FILE_CORRUPT;
+				ERR_FAIL_V(ERR_FILE_CORRUPT);
+			}
+			Error err = p_callback(i, t, name, *this);
+			if (err != OK) {
+				return err;
+			}
+			ERR_FAIL_COND_V_MSG(f->eof_reached(), ERR_FILE_CORRUPT, vformat("'%s': Unexpected EOF while reading property '%s'.", local_path, name));
+		}
+	}
+	return OK;
+}
+
+Error ResourceLoaderCompatBinary::read_array_header(uint32_t &r_len) {
+	uint32_t prop_type = f->get_32();
+	ERR_FAIL_COND_V_MSG(prop_type != VARIANT_ARRAY, ERR_PARSE_ERROR, vformat("'%s': Expected Array, got variant type %d.", local_path, prop_type));
+	r_len = f->get_32() & 0x7FFFFFFF; // last bit means shared
+	return OK;
+}
+
+Error ResourceLoaderCompatBinary::read_byte_array_header(uint32_t &r_len) {
+	uint32_t prop_type = f->get_32();
+	ERR_FAIL_COND_V_MSG(prop_type != VARIANT_PACKED_BYTE_ARRAY, ERR_PARSE_ERROR, vformat("'%s': Expected PackedByteArray, got variant type %d.", local_path, prop_type));
+	r_len = f->get_32();
+	return OK;
+}
+
 Error ResourceLoaderCompatBinary::load() {
 	if (error != OK) {
 		return error;
@@ -1105,7 +1146,10 @@ void ResourceLoaderCompatBinary::get_dependencies(Ref<FileAccess> p_f, List<Stri
 	if (error) {
 		return;
 	}
+	_get_external_dependencies(p_dependencies, p_add_types);
+}
 
+void ResourceLoaderCompatBinary::_get_external_dependencies(List<String> *p_dependencies, bool p_add_types) {
 	for (int i = 0; i < external_resources.size(); i++) {
 		String dep;
 		String fallback_path;
@@ -1809,6 +1853,17 @@ bool ResourceFormatLoaderCompatBinary::has_custom_uid_support() const {
 	return true;
 }
 
+Error ResourceFormatLoaderCompatBinary::open_for_streaming(const String &p_path, ResourceLoaderCompatBinary &r_loader) {
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ, &err);
+	ERR_FAIL_COND_V_MSG(f.is_null(), err, vformat("Cannot open file '%s'.", p_path));
+	r_loader.load_type = ResourceInfo::FAKE_LOAD;
+	r_loader.local_path = GDRESettings::get_singleton()->localize_path(p_path);
+	r_loader.res_path = r_loader.local_path;
+	r_loader.open(f);
+	return r_loader.error;
+}
+
 ///////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////
@@ -3185,6 +3240,42 @@ Ref<ResourceInfo> ResourceFormatLoaderCompatBinary::get_resource_info(const Stri
 	return res_info;
 }
 
+// Same as get_resource_info() followed by get_dependencies(), but only parses the header once
+Ref<ResourceInfo> ResourceFormatLoaderCompatBinary::get_resource_info_and_dependencies(const String &p_path, List<String> *r_dependencies, bool p_add_types, Error *r_error) {
+	if (r_error) {
+		*r_error = ERR_CANT_OPEN;
+	}
+
+	Error err;
+
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ, &err);
+	ERR_FAIL_COND_V_MSG(err, Ref<ResourceInfo>(), "Cannot open file '" + p_path + "'.");
+
+	ResourceLoaderCompatBinary loader;
+	String path = p_path;
+	loader.load_type = ResourceInfo::FAKE_LOAD;
+	loader.cache_mode = ResourceFormatLoader::CACHE_MODE_IGNORE;
+	loader.use_sub_threads = false;
+	loader.local_path = GDRESettings::get_singleton()->localize_path(path);
+	loader.res_path = loader.local_path;
+	loader.open(f, false, true);
+	ERR_FAIL_SET_ERR_V_MSG_SETERR(loader.error, Ref<ResourceInfo>(), "Cannot load binary resource " + p_path + ".");
+	loader._get_external_dependencies(r_dependencies, p_add_types);
+	if (loader.ver_major <= 2) {
+		f->seek(0);
+		loader.open(f, false, true);
+		err = loader.load_import_metadata(true);
+		if (err != OK && err != ERR_UNAVAILABLE) {
+			ERR_FAIL_SET_ERR_V_MSG_SETERR(err, loader.get_resource_info(), "Cannot load import metadata for v2 resource " + p_path + ".");
+		}
+	}
+	auto res_info = loader.get_resource_info();
+	if (r_error) {
+		*r_error = OK;
+	}
+	return res_info;
+}
+
 //	Error rewrite_v2_import_metadata(const String &p_path, const String &p_dst, Ref<ResourceImportMetadatav2> imd) const;
 namespace {
 bool require_whole_resave(Variant var) {
@@ -3474,6 +3565,25 @@ Error ResourceFormatLoaderCompatBinary::get_ver_major_minor(const String &p_path
 	if (err != OK || !f.is_valid()) {
 		return err != OK ? err : ERR_FILE_CANT_OPEN;
 	}
+	// Uncompressed resources only need the fixed-size header; avoid going through the loader for those.
+	uint8_t header[24];
+	if (f->get_buffer(header, 24) == 24 && header[0] == 'R' && header[1] == 'S' && header[2] == 'R' && header[3] == 'C') {
+		bool big_endian = decode_uint32(&header[4]) != 0;
+		auto read_u32 = [&](int p_ofs) {
+			uint32_t v = decode_uint32(&header[p_ofs]);
+			return big_endian ? BSWAP32(v) : v;
+		};
+		ResourceLoaderCompatBinary loader;
+		loader.ver_major = read_u32(12);
+		loader.ver_minor = read_u32(16);
+		loader.ver_format = read_u32(20);
+		loader.check_suspect_version();
+		r_ver_major = loader.ver_major;
+		r_ver_minor = loader.ver_minor;
+		r_suspicious = loader.suspect_version;
+		return OK;
+	}
+	f->seek(0);
 	ResourceLoaderCompatBinary loader;
 	return loader.get_ver_major_minor(f, r_ver_major, r_ver_minor, r_suspicious) ? OK : loader.error;
 }
@@ -41,6 +41,8 @@
 #include "scene/resources/packed_scene.h"
 #include "utility/resource_info.h"
 
+#include <functional>
+
 class ResourceLoaderCompatBinary {
 	bool translation_remapped = false;
 	String local_path;
@@ -139,9 +141,25 @@ public:
 	String recognize(Ref<FileAccess> p_f);
 	String recognize_script_class(Ref<FileAccess> p_f);
 	void get_dependencies(Ref<FileAccess> p_f, List<String> *p_dependencies, bool p_add_types);
+	// Formats the already-read external resource table as a dependency list
+	void _get_external_dependencies(List<String> *p_dependencies, bool p_add_types);
 	void get_classes_used(Ref<FileAccess> p_f, HashSet<StringName> *p_classes);
 	bool get_ver_major_minor(Ref<FileAccess> p_f, uint32_t &r_ver_major, uint32_t &r_ver_minor, bool &r_suspicious);
 
+	// Streaming access; visits the properties of every internal resource (main resource last) without constructing them.
+	// The callback is called with the file positioned at the property's value and must consume the whole value,
+	// either with read_variant() or by reading it from get_file() with the helpers below.
+	typedef std::function<Error(int p_res_idx, const String &p_res_type, const StringName &p_name, ResourceLoaderCompatBinary &p_loader)> PropertyStreamFunc;
+	Error stream_properties(const PropertyStreamFunc &p_callback);
+	Error read_variant(Variant &r_v) { return parse_variant(r_v); }
+	// Reads the header of an Array value and returns the number of elements that follow
+	Error read_array_header(uint32_t &r_len);
+	// Reads the header of a PackedByteArray value; the caller reads the r_len bytes and then calls skip_byte_array_padding()
+	Error read_byte_array_header(uint32_t &r_len);
+	void skip_byte_array_padding(uint32_t p_len) { _advance_padding(p_len); }
+	Ref<FileAccess> get_file() const { return f; }
+	Error get_error() const { return error; }
+
 	ResourceLoaderCompatBinary() {}
 };
 
@@ -154,9 +172,12 @@ protected:
 public:
 	static Error get_ver_major_minor(const String &p_path, uint32_t &r_ver_major, uint32_t &r_ver_minor, bool &r_suspicious);
 	static bool is_binary_resource(const String &p_path);
+	// Opens the resource for use with ResourceLoaderCompatBinary::stream_properties()
+	static Error open_for_streaming(const String &p_path, ResourceLoaderCompatBinary &r_loader);
 
 	virtual Ref<Resource> custom_load(const String &p_path, const String &p_original_path, ResourceInfo::LoadType p_type, Error *r_error = nullptr, bool use_threads = true, ResourceFormatLoader::CacheMode p_cache_mode = CACHE_MODE_REUSE) override;
 	virtual Ref<ResourceInfo> get_resource_info(const String &p_path, Error *r_error) const override;
+	virtual Ref<ResourceInfo> get_resource_info_and_dependencies(const String &p_path, List<String> *r_dependencies, bool p_add_types, Error *r_error) override;
 	virtual bool handles_fake_load() const override { return true; }
 
 	virtual Ref<Resource> load(const String &p_path, const String &p_original_path = "", Error *r_error = nullptr, bool p_use_sub_threads = false, float *r_progress = nullptr, CacheMode p_cache_mode = CACHE_MODE_REUSE) override;
@@ -1,5 +1,6 @@
 #include "resource_loader_compat.h"
 #include "compat/resource_compat_binary.h"
+#include "compat/resource_cache_compat.h"
 #include "compat/resource_compat_text.h"
 #include "compat/resource_format_xml.h"
 #include "core/error/error_list.h"
@@ -184,26 +185,46 @@ void ResourceCompatLoader::get_base_extensions_for_type(const String &p_type, Li
 	}
 }
 
-Ref<Resource> ResourceCompatLoader::fake_load(const String &p_path, const String &p_type_hint, Error *r_error) {
-	auto loadr = get_loader_for_path(p_path, p_type_hint);
-	FAIL_LOADER_NOT_FOUND(loadr);
-	Ref<Resource> res = loadr->custom_load(p_path, {}, ResourceInfo::LoadType::FAKE_LOAD, r_error, false, ResourceFormatLoader::CACHE_MODE_IGNORE);
-	if (res.is_valid() && res->get_path().is_empty()) {
-		res->set_path_cache(p_path);
-	}
-	return res;
+namespace {
+// Only resources in the loaded packs are cached; anything else (e.g. temp files written during testing) may change on disk
+bool _should_use_compat_cache(const String &p_path) {
+	return ResourceCacheCompat::is_enabled() && p_path.begins_with("res://");
 }
+} //namespace
 
-Ref<Resource> ResourceCompatLoader::non_global_load(const String &p_path, const String &p_type_hint, Error *r_error) {
+Ref<Resource> ResourceCompatLoader::_cached_ignore_load(const String &p_path, const String &p_type_hint, ResourceInfo::LoadType p_type, Error *r_error) {
+	bool use_cache = _should_use_compat_cache(p_path);
+	uint64_t cache_generation = 0;
+	if (use_cache) {
+		Ref<Resource> res = ResourceCacheCompat::get(p_path, p_type, &cache_generation);
+		if (res.is_valid()) {
+			if (r_error) {
+				*r_error = OK;
+			}
+			return res;
+		}
+	}
 	auto loader = get_loader_for_path(p_path, p_type_hint);
 	FAIL_LOADER_NOT_FOUND(loader);
-	Ref<Resource> res = loader->custom_load(p_path, {}, ResourceInfo::LoadType::NON_GLOBAL_LOAD, r_error, false, ResourceFormatLoader::CACHE_MODE_IGNORE);
+	Ref<Resource> res = loader->custom_load(p_path, {}, p_type, r_error, false, ResourceFormatLoader::CACHE_MODE_IGNORE);
 	if (res.is_valid() && res->get_path().is_empty()) {
 		res->set_path_cache(p_path);
 	}
+	if (use_cache && res.is_valid()) {
+		// the on-disk size is a rough estimate of the in-memory size
+		ResourceCacheCompat::put(p_path, p_type, res, MAX((int64_t)FileAccess::get_size(GDRESettings::get_singleton()->get_mapped_path(p_path)), (int64_t)1024), cache_generation);
+	}
 	return res;
 }
 
+Ref<Resource> ResourceCompatLoader::fake_load(const String &p_path, const String &p_type_hint, Error *r_error) {
+	return _cached_ignore_load(p_path, p_type_hint, ResourceInfo::LoadType::FAKE_LOAD, r_error);
+}
+
+Ref<Resource> ResourceCompatLoader::non_global_load(const String &p_path, const String &p_type_hint, Error *r_error) {
+	return _cached_ignore_load(p_path, p_type_hint, ResourceInfo::LoadType::NON_GLOBAL_LOAD, r_error);
+}
+
 Ref<Resource> ResourceCompatLoader::gltf_load(const String &p_path, const String &p_type_hint, Error *r_error) {
 	return ResourceCompatLoader::custom_load(p_path, p_type_hint, ResourceInfo::LoadType::GLTF_LOAD, r_error);
 }
@@ -553,6 +574,18 @@ void ResourceCompatLoader::get_dependencies(const String &p_path, List<String> *
 	loader->get_dependencies(p_path, p_dependencies, p_add_types);
 }
 
+Ref<ResourceInfo> ResourceCompatLoader::get_resource_info_and_dependencies(const String &p_path, List<String> *r_dependencies, bool p_add_types, Error *r_error) {
+	auto loader = get_loader_for_path(p_path, "");
+	if (loader.is_null()) {
+		if (r_error) {
+			*r_error = ERR_UNAVAILABLE;
+		}
+		ResourceLoader::get_dependencies(p_path, r_dependencies, p_add_types);
+		return Ref<ResourceInfo>();
+	}
+	return loader->get_resource_info_and_dependencies(p_path, r_dependencies, p_add_types, r_error);
+}
+
 // static String get_resource_script_class(const String &p_path);
 String ResourceCompatLoader::get_resource_script_class(const String &p_path) {
 	auto loader = get_loader_for_path(p_path, "");
@@ -712,6 +745,12 @@ Ref<ResourceInfo> CompatFormatLoader::get_resource_info(const String &p_path, Er
 	}
 	ERR_FAIL_V_MSG(Ref<ResourceInfo>(), "Not implemented.");
 }
+Ref<ResourceInfo> CompatFormatLoader::get_resource_info_and_dependencies(const String &p_path, List<String> *r_dependencies, bool p_add_types, Error *r_error) {
+	auto info = get_resource_info(p_path, r_error);
+	get_dependencies(p_path, r_dependencies, p_add_types);
+	return info;
+}
+
 bool CompatFormatLoader::handles_fake_load() const {
 	return false;
 }
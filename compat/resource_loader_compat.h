@@ -34,6 +34,7 @@ protected:
 
 	static void _bind_methods();
 
+	static Ref<Resource> _cached_ignore_load(const String &p_path, const String &p_type_hint, ResourceInfo::LoadType p_type, Error *r_error);
 	static Ref<Resource> _load_for_text_conversion(const String &p_path, const String &original_path = "", Error *r_error = nullptr);
 
 public:
@@ -53,6 +54,8 @@ public:
 	static Ref<ResourceCompatConverter> get_converter_for_type(const String &p_type, int ver_major);
 	static Ref<ResourceInfo> get_resource_info(const String &p_path, const String &p_type_hint = "", Error *r_error = nullptr);
 	static void get_dependencies(const String &p_path, List<String> *p_dependencies, bool p_add_types = false);
+	// Gets both the resource info and the dependencies, parsing the resource only once if the loader supports it
+	static Ref<ResourceInfo> get_resource_info_and_dependencies(const String &p_path, List<String> *r_dependencies, bool p_add_types = false, Error *r_error = nullptr);
 	static Error to_text(const String &p_path, const String &p_dst, uint32_t p_flags = 0, const String &original_path = {});
 	static Error to_binary(const String &p_path, const String &p_dst, uint32_t p_flags = 0);
 	static bool handles_resource(const String &p_path, const String &p_type_hint = "");
@@ -80,6 +83,7 @@ class CompatFormatLoader : public ResourceFormatLoader {
 public:
 	virtual Ref<Resource> custom_load(const String &p_path, const String &p_original_path, ResourceInfo::LoadType p_type, Error *r_error = nullptr, bool use_threads = true, ResourceFormatLoader::CacheMode p_cache_mode = CACHE_MODE_REUSE);
 	virtual Ref<ResourceInfo> get_resource_info(const String &p_path, Error *r_error) const;
+	virtual Ref<ResourceInfo> get_resource_info_and_dependencies(const String &p_path, List<String> *r_dependencies, bool p_add_types, Error *r_error);
 	virtual bool handles_fake_load() const;
 
 	static constexpr int get_format_version_from_flags(uint32_t p_flags) {
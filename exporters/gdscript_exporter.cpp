@@ -25,7 +25,10 @@ Error GDScriptExporter::export_file(const String &out_path, const String &res_pa
 Error GDScriptExporter::_export_file(const String &out_path, Ref<FakeGDScript> gdscript) {
 	String source = gdscript->get_source_code();
 	ERR_FAIL_COND_V_MSG(source.is_empty(), ERR_FILE_CORRUPT, "Script source is empty: " + gdscript->get_script_path());
+	return _export_source(out_path, source);
+}
 
+Error GDScriptExporter::_export_source(const String &out_path, const String &source) {
 	Error err = gdre::ensure_dir(out_path.get_base_dir());
 	ERR_FAIL_COND_V_MSG(err != OK, err, "Failed to ensure output directory exists: " + out_path.get_base_dir());
 
@@ -37,14 +40,21 @@ Error GDScriptExporter::_export_file(const String &out_path, Ref<FakeGDScript> g
 }
 
 Ref<ExportReport> GDScriptExporter::export_resource(const String &output_dir, Ref<ImportInfo> import_infos) {
+	return export_script(output_dir, import_infos, Ref<GDScriptDecomp>());
+}
+
+Ref<ExportReport> GDScriptExporter::export_script(const String &output_dir, Ref<ImportInfo> import_infos, Ref<GDScriptDecomp> decomp) {
 	Ref<ExportReport> report = memnew(ExportReport(import_infos, get_name()));
 	report->set_resources_used({ import_infos->get_path() });
 
 	String import_path = import_infos->get_path();
+	String actual_path = GDRESettings::get_singleton()->get_mapped_path(import_path);
 	String export_path = output_dir.path_join(import_infos->get_export_dest().replace("res://", ""));
 
-	// Handle encrypted scripts
-	bool is_encrypted = import_path.get_extension().to_lower() == "gde";
+	// Read (and decrypt) the bytecode directly; we don't need a full FakeGDScript just to write out the source
+	Vector<uint8_t> buffer;
+	Error err = OK;
+	bool is_encrypted = actual_path.get_extension().to_lower() == "gde";
 	if (is_encrypted) {
 		auto key = GDRESettings::get_singleton()->get_encryption_key();
 		if (key.size() == 0) {
@@ -52,26 +62,62 @@ Ref<ExportReport> GDScriptExporter::export_resource(const String &output_dir, Re
 			report->set_message("No encryption key provided for encrypted script");
 			return report;
 		}
+		err = GDScriptDecomp::get_buffer_encrypted(actual_path, 3, key, buffer);
+		if (err != OK) {
+			report->set_error(err);
+			report->set_message(err == ERR_UNAUTHORIZED ? "Encryption key is incorrect for encrypted script" : "Error reading encrypted file: " + import_path);
+			return report;
+		}
+	} else {
+		buffer = FileAccess::get_file_as_bytes(actual_path, &err);
+		if (err != OK) {
+			report->set_error(err);
+			report->set_message("Error reading file: " + import_path);
+			return report;
+		}
 	}
-	Ref<FakeGDScript> gdscript;
-	gdscript.instantiate();
-	Error err = gdscript->load_source_code(import_path);
-	if (err != OK) {
-		report->set_error(err);
-		if (is_encrypted && err == ERR_UNAUTHORIZED) {
-			report->set_message("Encryption key is incorrect for encrypted script");
-		} else {
-			report->set_message(gdscript->get_error_message());
+
+	String source;
+	if (!_GDRE_CHECK_HEADER(buffer, "GDSC")) {
+		// plain text script stored with a bytecode extension
+		err = source.append_utf8(reinterpret_cast<const char *>(buffer.ptr()), buffer.size());
+		if (err != OK) {
+			report->set_error(err);
+			report->set_message("Error reading file: " + import_path);
+			return report;
 		}
-		return report;
+	} else {
+		if (decomp.is_null()) {
+			int revision = GDRESettings::get_singleton()->get_bytecode_revision();
+			if (revision == 0) {
+				report->set_error(ERR_UNCONFIGURED);
+				report->set_message("No bytecode revision set");
+				return report;
+			}
+			decomp = GDScriptDecomp::create_decomp_for_commit(revision);
+			if (decomp.is_null()) {
+				report->set_error(ERR_FILE_UNRECOGNIZED);
+				report->set_message("Unknown version, failed to decompile");
+				return report;
+			}
+		}
+		err = decomp->decompile_buffer(buffer);
+		if (err != OK) {
+			report->set_error(err);
+			report->set_message("Error decompiling code: " + decomp->get_error_message());
+			return report;
+		}
+		source = decomp->get_script_text();
 	}
-	if (gdscript->get_source_code().is_empty()) {
+	buffer.clear();
+
+	if (source.is_empty()) {
 		report->set_error(ERR_FILE_CORRUPT);
 		report->set_message("Script source is empty");
 		return report;
 	}
 	// Export the script
-	err = _export_file(export_path, gdscript);
+	err = _export_source(export_path, source);
 	if (err != OK) {
 		report->set_error(err);
 		return report;
@@ -6,10 +6,12 @@
 #include "utility/import_info.h"
 
 class FakeGDScript;
+class GDScriptDecomp;
 class GDScriptExporter : public ResourceExporter {
 	GDCLASS(GDScriptExporter, ResourceExporter);
 
 	virtual Error _export_file(const String &out_path, Ref<FakeGDScript> res);
+	Error _export_source(const String &out_path, const String &source);
 
 protected:
 	static void _bind_methods();
@@ -18,6 +20,9 @@ public:
 	static constexpr const char *const EXPORTER_NAME = "GDScript";
 	virtual Error export_file(const String &out_path, const String &res_path) override;
 	virtual Ref<ExportReport> export_resource(const String &output_dir, Ref<ImportInfo> import_infos) override;
+	// Same as `export_resource`, but reuses the given decompiler instead of creating a new one for each script.
+	// The decompiler must not be used concurrently by other threads.
+	Ref<ExportReport> export_script(const String &output_dir, Ref<ImportInfo> import_infos, Ref<GDScriptDecomp> decomp);
 	virtual void get_handled_types(List<String> *out) const override;
 	virtual void get_handled_importers(List<String> *out) const override;
 	virtual bool supports_multithread() const override;
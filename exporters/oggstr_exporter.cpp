@@ -1,5 +1,6 @@
 #include "oggstr_exporter.h"
 #include "compat/oggstr_loader_compat.h"
+#include "compat/resource_compat_binary.h"
 #include "compat/resource_loader_compat.h"
 #include "core/error/error_list.h"
 #include "core/error/error_macros.h"
@@ -94,6 +95,149 @@ Error OggStrExporter::get_data_from_ogg_stream(const String &real_src, const Ref
 	return warned ? ERR_PRINTER_ON_FIRE : OK;
 }
 
+namespace {
+Dictionary get_default_ogg_params() {
+	Dictionary params;
+	params["loop"] = false;
+	params["loop_offset"] = 0.0;
+	params["bpm"] = 0.0;
+	params["beat_count"] = 0;
+	params["bar_beats"] = 4;
+	return params;
+}
+} //namespace
+
+Error OggStrExporter::remux_ogg_stream(const String &real_src, const String &p_path, const String &dst_path, Dictionary &r_params) {
+	ResourceLoaderCompatBinary loader;
+	Error err = ResourceFormatLoaderCompatBinary::open_for_streaming(p_path, loader);
+	ERR_FAIL_COND_V_MSG(err != OK, err, "Cannot open resource '" + p_path + "'.");
+
+	// First pass: read everything except the packet data, noting where it starts and how big each page is
+	uint64_t packet_data_ofs = 0;
+	Vector<uint64_t> page_sizes;
+	Vector<int64_t> granule_positions;
+	r_params = get_default_ogg_params();
+	err = loader.stream_properties([&](int p_res_idx, const String &p_res_type, const StringName &p_name, ResourceLoaderCompatBinary &p_loader) -> Error {
+		Ref<FileAccess> f = p_loader.get_file();
+		if (p_res_type == "OggPacketSequence" && p_name == "packet_data") {
+			packet_data_ofs = f->get_position();
+			uint32_t page_count = 0;
+			Error e = p_loader.read_array_header(page_count);
+			ERR_FAIL_COND_V(e != OK, e);
+			page_sizes.resize(page_count);
+			for (uint32_t i = 0; i < page_count; i++) {
+				uint32_t packet_count = 0;
+				e = p_loader.read_array_header(packet_count);
+				ERR_FAIL_COND_V(e != OK, e);
+				uint64_t page_size = 0;
+				for (uint32_t j = 0; j < packet_count; j++) {
+					uint32_t len = 0;
+					e = p_loader.read_byte_array_header(len);
+					ERR_FAIL_COND_V(e != OK, e);
+					f->seek(f->get_position() + len);
+					p_loader.skip_byte_array_padding(len);
+					page_size += len;
+				}
+				page_sizes.write[i] = page_size;
+			}
+			return OK;
+		}
+		Variant value;
+		Error e = p_loader.read_variant(value);
+		ERR_FAIL_COND_V(e != OK, e);
+		if (p_res_type == "OggPacketSequence" && p_name == "granule_positions") {
+			granule_positions = value;
+		} else if (p_res_type == "AudioStreamOggVorbis" && r_params.has(p_name)) {
+			r_params[p_name] = value;
+		}
+		return OK;
+	});
+	ERR_FAIL_COND_V_MSG(err != OK, err, "Failed to read Ogg packet sequence from " + p_path);
+	ERR_FAIL_COND_V_MSG(packet_data_ofs == 0 || page_sizes.is_empty(), ERR_FILE_CORRUPT, "No packet data in " + p_path);
+	ERR_FAIL_COND_V_MSG(granule_positions.size() < page_sizes.size(), ERR_FILE_CORRUPT, "Missing granule positions in " + p_path);
+
+	err = gdre::ensure_dir(dst_path.get_base_dir());
+	ERR_FAIL_COND_V_MSG(err != OK, err, "Failed to create directory for " + dst_path);
+	Ref<FileAccess> fw = FileAccess::open(dst_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(fw.is_null(), ERR_FILE_CANT_WRITE, "Cannot open file '" + dst_path + "' for writing.");
+
+	// Second pass: feed the packets one at a time into the ogg stream and write out pages as they fill up
+	Ref<FileAccess> f = loader.get_file();
+	f->seek(packet_data_ofs);
+	uint32_t page_count = 0;
+	loader.read_array_header(page_count);
+
+	ogg_stream_state os_en;
+	ogg_stream_init(&os_en, real_src.hash());
+	Vector<uint8_t> packet_buf;
+	int64_t packetno = 0;
+	bool reached_eos = false;
+	bool warned = false;
+	int64_t total_written = 0;
+	for (uint32_t i = 0; i < page_count && !reached_eos && err == OK; i++) {
+		uint32_t packet_count = 0;
+		err = loader.read_array_header(packet_count);
+		for (uint32_t j = 0; j < packet_count && !reached_eos && err == OK; j++) {
+			uint32_t len = 0;
+			err = loader.read_byte_array_header(len);
+			if (err != OK) {
+				break;
+			}
+			if (len > (uint32_t)packet_buf.size()) {
+				packet_buf.resize(next_power_of_2(len));
+			}
+			if (f->get_buffer(packet_buf.ptrw(), len) != len) {
+				err = ERR_FILE_CORRUPT;
+				break;
+			}
+			loader.skip_byte_array_padding(len);
+
+			// Same packet fields as OggPacketSequencePlayback::next_ogg_packet()
+			ogg_packet pkt = {};
+			pkt.packet = packet_buf.ptrw();
+			pkt.bytes = len;
+			pkt.b_o_s = i == 0 && j == 0;
+			pkt.e_o_s = i == page_count - 1 && j == packet_count - 1;
+			pkt.granulepos = j == packet_count - 1 ? granule_positions[i] : -1;
+			pkt.packetno = packetno++;
+			reached_eos = pkt.e_o_s;
+
+			ogg_stream_packetin(&os_en, &pkt);
+			if (ogg_stream_check(&os_en)) {
+				err = ERR_FILE_CORRUPT;
+				break;
+			}
+			int64_t page_size = page_sizes[i];
+			if (os_en.body_fill >= page_size || reached_eos) {
+				if (os_en.body_fill < page_size) {
+					WARN_PRINT("Reached EOS: Recorded page size is " + itos(page_size) + " but body fill is " + itos(os_en.body_fill) + ".");
+					warned = true;
+				}
+				ogg_page og;
+				if (ogg_stream_flush_fill(&os_en, &og, page_size) == 0) {
+					err = ERR_FILE_CORRUPT;
+					break;
+				}
+				fw->store_buffer(og.header, og.header_len);
+				fw->store_buffer(og.body, og.body_len);
+				total_written += og.header_len + og.body_len;
+			}
+		}
+	}
+	ogg_stream_clear(&os_en);
+	fw->flush();
+	if (err == OK && !reached_eos) {
+		err = ERR_FILE_CORRUPT;
+	}
+	if (err != OK || fw->get_error() != OK || total_written < 4) {
+		fw.unref();
+		DirAccess::remove_absolute(dst_path);
+		ERR_FAIL_COND_V_MSG(err != OK, err, "Failed to remux Ogg stream from " + p_path);
+		ERR_FAIL_V_MSG(ERR_FILE_CANT_WRITE, "Failed to write Ogg stream to " + dst_path);
+	}
+	return warned ? ERR_PRINTER_ON_FIRE : OK;
+}
+
 Vector<uint8_t> OggStrExporter::get_ogg_stream_data(const String &real_src, const Ref<AudioStreamOggVorbis> &sample) {
 	Error _err = OK;
 	Vector<uint8_t> data;
@@ -133,23 +277,39 @@ Vector<uint8_t> OggStrExporter::load_ogg_stream_data(const String &real_src, con
 	return data;
 }
 
-Error OggStrExporter::_export_file(const String real_src, const String &dst_path, const String &res_path, Ref<AudioStreamOggVorbis> &r_sample, int ver_major) {
+Error OggStrExporter::_export_file(const String real_src, const String &dst_path, const String &res_path, Dictionary &r_params, int ver_major) {
 	Error err = OK;
 	if (ver_major == 0) {
 		ver_major = get_ver_major(res_path);
 	}
-	Vector<uint8_t> data = load_ogg_stream_data(real_src, res_path, r_sample, ver_major, &err);
+	if (ver_major == 4 && ResourceFormatLoaderCompatBinary::is_binary_resource(res_path)) {
+		err = remux_ogg_stream(real_src, res_path, dst_path, r_params);
+		if (err == ERR_PRINTER_ON_FIRE) {
+			WARN_PRINT("Ogg stream had warnings: " + res_path);
+			err = OK;
+		}
+		return err;
+	}
+	Ref<AudioStreamOggVorbis> sample;
+	Vector<uint8_t> data = load_ogg_stream_data(real_src, res_path, sample, ver_major, &err);
 	ERR_FAIL_COND_V_MSG(err != OK, err, "Failed to load Ogg stream data from " + res_path);
 	err = gdre::ensure_dir(dst_path.get_base_dir());
 	Ref<FileAccess> f = FileAccess::open(dst_path, FileAccess::WRITE);
 	ERR_FAIL_COND_V_MSG(f.is_null(), ERR_FILE_CANT_WRITE, "Cannot open file '" + dst_path + "' for writing.");
 	f->store_buffer(data.ptr(), data.size());
+	if (sample.is_valid()) { // sample only gets set if ver_major is 4
+		r_params["loop"] = sample->has_loop();
+		r_params["loop_offset"] = sample->get_loop_offset();
+		r_params["bpm"] = sample->get_bpm();
+		r_params["beat_count"] = sample->get_beat_count();
+		r_params["bar_beats"] = sample->get_bar_beats();
+	}
 	return OK;
 }
 
 Error OggStrExporter::export_file(const String &dst_path, const String &res_path) {
-	Ref<AudioStreamOggVorbis> sample;
-	return _export_file(dst_path, dst_path, res_path, sample, get_ver_major(res_path));
+	Dictionary params;
+	return _export_file(dst_path, dst_path, res_path, params, get_ver_major(res_path));
 }
 
 Ref<ExportReport> OggStrExporter::export_resource(const String &output_dir, Ref<ImportInfo> import_info) {
@@ -159,10 +319,10 @@ Ref<ExportReport> OggStrExporter::export_resource(const String &output_dir, Ref<
 	Ref<ExportReport> report = memnew(ExportReport(import_info, get_name()));
 	report->set_resources_used({ import_info->get_path() });
 
-	Ref<AudioStreamOggVorbis> sample;
+	Dictionary params;
 	// Doing this because Godot's ogg vorbis loader loves to spam errors about "invalid comments"
 	GDRELogger::set_thread_local_silent_errors(true);
-	Error err = _export_file(import_info->get_source_file(), dst_path, src_path, sample, import_info->get_ver_major());
+	Error err = _export_file(import_info->get_source_file(), dst_path, src_path, params, import_info->get_ver_major());
 	GDRELogger::set_thread_local_silent_errors(false);
 	if (err != OK) {
 		report->set_error(err);
@@ -175,12 +335,9 @@ Ref<ExportReport> OggStrExporter::export_resource(const String &output_dir, Ref<
 	} else {
 		print_verbose("Converted " + src_path + " to " + dst_path);
 		report->set_saved_path(dst_path);
-		if (sample.is_valid()) { // sample only gets set if ver_major is 4
-			import_info->set_param("loop", sample->has_loop());
-			import_info->set_param("loop_offset", sample->get_loop_offset());
-			import_info->set_param("bpm", sample->get_bpm());
-			import_info->set_param("beat_count", sample->get_beat_count());
-			import_info->set_param("bar_beats", sample->get_bar_beats());
+		// params only get set if ver_major is 4
+		for (const Variant &key : params.keys()) {
+			import_info->set_param(key, params[key]);
 		}
 	}
 	return report;
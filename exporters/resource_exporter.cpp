@@ -1,4 +1,5 @@
 #include "resource_exporter.h"
+#include "compat/resource_cache_compat.h"
 #include "compat/resource_loader_compat.h"
 #include "utility/common.h"
 #include "utility/gdre_settings.h"
@@ -30,6 +31,10 @@ bool ResourceExporter::supports_multithread() const {
 	return true;
 }
 
+bool ResourceExporter::uses_shared_resource_cache() const {
+	return true;
+}
+
 bool ResourceExporter::handles_import(const String &importer, const String &resource_type) const {
 	if (!importer.is_empty()) {
 		List<String> handled_importers;
@@ -173,6 +178,7 @@ Ref<ExportReport> Exporter::export_resource(const String &output_dir, Ref<Import
 		report->set_error(ERR_UNAVAILABLE);
 		return report;
 	}
+	ResourceCacheCompat::Bypass bypass(!exporter->uses_shared_resource_cache());
 	return exporter->export_resource(output_dir, import_infos);
 }
 
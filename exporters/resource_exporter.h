@@ -20,6 +20,8 @@ public:
 	virtual void get_handled_types(List<String> *out) const;
 	virtual void get_handled_importers(List<String> *out) const;
 	virtual bool supports_multithread() const;
+	// Whether resources loaded during export may be shared with other exporters through ResourceCacheCompat; exporters that modify the resources they load should return false
+	virtual bool uses_shared_resource_cache() const;
 	virtual bool supports_nonpack_export() const;
 	virtual String get_default_export_extension(const String &res_path) const;
 	virtual Error test_export(const Ref<ExportReport> &export_report, const String &original_project_dir) const;
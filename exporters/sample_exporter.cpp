@@ -5,18 +5,133 @@
 #include "utility/common.h"
 #include "utility/import_info.h"
 
+#include "core/object/worker_thread_pool.h"
+#include "core/os/thread.h"
 #include "core/string/ustring.h"
 #include "exporters/export_report.h"
 #include "scene/resources/audio_stream_wav.h"
 
-struct IMA_ADPCM_State {
-	int16_t step_index = 0;
-	int32_t predictor = 0;
-	int32_t last_nibble = -1;
-};
-
 #define DATA_PAD 16
 namespace {
+// Don't bother spinning up worker threads for anything shorter than this.
+// Decoding only fans out when called from the main thread; export tasks already run on the worker pool,
+// and waiting on a nested group task from a worker can deadlock it.
+constexpr int64_t MIN_SAMPLES_FOR_MULTITHREAD = 1 << 18;
+
+constexpr int16_t ima_adpcm_step_table[89] = {
+	7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+	19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+	50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+	130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+	337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+	876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+	2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+	5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+	15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+constexpr int8_t ima_adpcm_index_table[16] = {
+	-1, -1, -1, -1, 2, 4, 6, 8,
+	-1, -1, -1, -1, 2, 4, 6, 8
+};
+
+// Precomputed (step_index, nibble) -> (diff, next step_index), so decoding a nibble is a single lookup.
+struct IMA_ADPCM_Table {
+	struct Entry {
+		int16_t diff;
+		uint8_t next_index;
+	};
+	Entry entries[89][16];
+
+	IMA_ADPCM_Table() {
+		for (int step_index = 0; step_index < 89; step_index++) {
+			int16_t step = ima_adpcm_step_table[step_index];
+			for (int nibble = 0; nibble < 16; nibble++) {
+				int16_t diff = step >> 3;
+				if (nibble & 1) {
+					diff += step >> 2;
+				}
+				if (nibble & 2) {
+					diff += step >> 1;
+				}
+				if (nibble & 4) {
+					diff += step;
+				}
+				if (nibble & 8) {
+					diff = -diff;
+				}
+				entries[step_index][nibble].diff = diff;
+				entries[step_index][nibble].next_index = CLAMP(step_index + ima_adpcm_index_table[nibble], 0, 88);
+			}
+		}
+	}
+
+	static const IMA_ADPCM_Table &get() {
+		static const IMA_ADPCM_Table table;
+		return table;
+	}
+};
+
+struct IMA_ADPCM_Decoder {
+	const uint8_t *src = nullptr;
+	int16_t *dest = nullptr;
+	int64_t src_bytes_per_channel = 0;
+	int64_t samples_per_channel = 0;
+	int channels = 1;
+
+	// Each channel has its own predictor and step index, so they can be decoded independently
+	void decode_channel(uint32_t p_channel, void *p_userdata = nullptr) {
+		const IMA_ADPCM_Table::Entry(*table)[16] = IMA_ADPCM_Table::get().entries;
+		const uint8_t *ch_src = src + p_channel;
+		int16_t *ch_dest = dest + p_channel;
+		int32_t predictor = 0;
+		uint8_t step_index = 0;
+		int64_t full_bytes = MIN(src_bytes_per_channel, samples_per_channel / 2);
+		for (int64_t i = 0; i < full_bytes; i++) {
+			uint8_t nbb = ch_src[i * channels];
+			// low nibble first
+			const IMA_ADPCM_Table::Entry &lo = table[step_index][nbb & 0xF];
+			predictor = CLAMP(predictor + lo.diff, -0x8000, 0x7FFF);
+			step_index = lo.next_index;
+			ch_dest[(i * 2) * channels] = predictor;
+			const IMA_ADPCM_Table::Entry &hi = table[step_index][nbb >> 4];
+			predictor = CLAMP(predictor + hi.diff, -0x8000, 0x7FFF);
+			step_index = hi.next_index;
+			ch_dest[(i * 2 + 1) * channels] = predictor;
+		}
+		// odd sample count
+		if (full_bytes * 2 < samples_per_channel && full_bytes < src_bytes_per_channel) {
+			const IMA_ADPCM_Table::Entry &lo = table[step_index][ch_src[full_bytes * channels] & 0xF];
+			predictor = CLAMP(predictor + lo.diff, -0x8000, 0x7FFF);
+			ch_dest[(full_bytes * 2) * channels] = predictor;
+		}
+	}
+};
+
+struct QOA_Decoder {
+	const uint8_t *bytes = nullptr;
+	unsigned int size = 0;
+	unsigned int header_size = 0;
+	unsigned int frame_size = 0;
+	qoa_desc desc;
+	int16_t *dest = nullptr;
+	Vector<unsigned int> frame_lens;
+
+	// Every frame carries its own LMS state in its header, so they can be decoded in any order
+	void decode_frame(uint32_t p_frame, void *p_userdata = nullptr) {
+		qoa_desc frame_desc = desc;
+		unsigned int offset = header_size + p_frame * frame_size;
+		unsigned int frame_len = 0;
+		if (offset < size) {
+			int16_t *sample_ptr = dest + (int64_t)p_frame * QOA_FRAME_LEN * desc.channels;
+			if (qoa_decode_frame(bytes + offset, size - offset, &frame_desc, sample_ptr, &frame_len) == 0) {
+				frame_len = 0;
+			}
+		}
+		frame_lens.write[p_frame] = frame_len;
+	}
+};
+
 int64_t qoa_decode(const unsigned char *bytes, int size, qoa_desc *qoa, Vector<uint8_t> &r_dest_data) {
 	unsigned int p = qoa_decode_header(bytes, size, qoa);
 	if (!p) {
@@ -24,25 +139,39 @@ int64_t qoa_decode(const unsigned char *bytes, int size, qoa_desc *qoa, Vector<u
 	}
 
 	/* Calculate the required size of the sample buffer and allocate */
-	int total_samples = qoa->samples * qoa->channels;
-	r_dest_data.resize(total_samples * sizeof(short));
-	int16_t *sample_data = (int16_t *)r_dest_data.ptrw();
+	int64_t total_samples = (int64_t)qoa->samples * qoa->channels;
+	r_dest_data.resize_initialized(total_samples * sizeof(short));
+
+	QOA_Decoder decoder;
+	decoder.bytes = bytes;
+	decoder.size = size;
+	decoder.header_size = p;
+	decoder.frame_size = QOA_FRAME_SIZE(qoa->channels, QOA_SLICES_PER_FRAME);
+	decoder.desc = *qoa;
+	decoder.dest = (int16_t *)r_dest_data.ptrw();
+	uint32_t num_frames = (qoa->samples + QOA_FRAME_LEN - 1) / QOA_FRAME_LEN;
+	decoder.frame_lens.resize(num_frames);
+	if (num_frames > 1 && qoa->samples >= MIN_SAMPLES_FOR_MULTITHREAD && Thread::is_main_thread()) {
+		auto group_id = WorkerThreadPool::get_singleton()->add_template_group_task(
+				&decoder, &QOA_Decoder::decode_frame, (void *)nullptr, num_frames, -1, true, SNAME("SampleExporter::qoa_decode"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_id);
+	} else {
+		for (uint32_t i = 0; i < num_frames; i++) {
+			decoder.decode_frame(i);
+		}
+	}
 
+	// Stop counting at the first frame that failed to decode, same as decoding them in order would
 	unsigned int sample_index = 0;
-	unsigned int frame_len;
-	unsigned int frame_size;
-
-	/* Decode all frames */
-	do {
-		short *sample_ptr = sample_data + sample_index * qoa->channels;
-		frame_size = qoa_decode_frame(bytes + p, size - p, qoa, sample_ptr, &frame_len);
-
-		p += frame_size;
-		sample_index += frame_len;
-	} while (frame_size && sample_index < qoa->samples);
+	for (uint32_t i = 0; i < num_frames; i++) {
+		sample_index += decoder.frame_lens[i];
+		if (decoder.frame_lens[i] < QOA_FRAME_LEN) {
+			break;
+		}
+	}
 
 	// qoa->samples = sample_index;
-	return sample_index;
+	return MIN(sample_index, qoa->samples);
 }
 } //namespace
 
@@ -83,94 +212,27 @@ Ref<AudioStreamWAV> SampleExporter::convert_adpcm_to_16bit(const Ref<AudioStream
 	new_sample->set_mix_rate(p_sample->get_mix_rate());
 	new_sample->set_stereo(p_sample->is_stereo());
 
-	IMA_ADPCM_State p_ima_adpcm[2];
-	int32_t final, final_r;
-	int64_t p_offset = 0;
-	int64_t p_increment = 1;
 	auto data = p_sample->get_data(); // This gets the data past the DATA_PAD, so no need to add it to the offsets.
 	bool is_stereo = p_sample->is_stereo();
+	int channels = is_stereo ? 2 : 1;
 	int64_t p_amount = data.size() * (is_stereo ? 1 : 2); // number of samples for EACH channel, not total
 	Vector<uint8_t> dest_data;
-	dest_data.resize(p_amount * sizeof(int16_t) * (is_stereo ? 2 : 1)); // number of 16-bit samples * number of channels
-	int16_t *dest = (int16_t *)dest_data.ptrw();
-	while (p_amount) {
-		p_amount--;
-		int64_t pos = p_offset;
-
-		while (pos > p_ima_adpcm[0].last_nibble) {
-			static const int16_t _ima_adpcm_step_table[89] = {
-				7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
-				19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
-				50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
-				130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
-				337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
-				876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
-				2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
-				5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
-				15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
-			};
-
-			static const int8_t _ima_adpcm_index_table[16] = {
-				-1, -1, -1, -1, 2, 4, 6, 8,
-				-1, -1, -1, -1, 2, 4, 6, 8
-			};
-
-			for (int i = 0; i < (is_stereo ? 2 : 1); i++) {
-				int16_t nibble, diff, step;
-
-				p_ima_adpcm[i].last_nibble++;
-				const uint8_t *src_ptr = (const uint8_t *)data.ptr();
-				// src_ptr += AudioStreamWAV::DATA_PAD;
-				int source_index = (p_ima_adpcm[i].last_nibble >> 1) * (is_stereo ? 2 : 1) + i;
-				uint8_t nbb = src_ptr[source_index];
-				nibble = (p_ima_adpcm[i].last_nibble & 1) ? (nbb >> 4) : (nbb & 0xF);
-				step = _ima_adpcm_step_table[p_ima_adpcm[i].step_index];
-
-				p_ima_adpcm[i].step_index += _ima_adpcm_index_table[nibble];
-				if (p_ima_adpcm[i].step_index < 0) {
-					p_ima_adpcm[i].step_index = 0;
-				}
-				if (p_ima_adpcm[i].step_index > 88) {
-					p_ima_adpcm[i].step_index = 88;
-				}
-
-				diff = step >> 3;
-				if (nibble & 1) {
-					diff += step >> 2;
-				}
-				if (nibble & 2) {
-					diff += step >> 1;
-				}
-				if (nibble & 4) {
-					diff += step;
-				}
-				if (nibble & 8) {
-					diff = -diff;
-				}
-
-				p_ima_adpcm[i].predictor += diff;
-				if (p_ima_adpcm[i].predictor < -0x8000) {
-					p_ima_adpcm[i].predictor = -0x8000;
-				} else if (p_ima_adpcm[i].predictor > 0x7FFF) {
-					p_ima_adpcm[i].predictor = 0x7FFF;
-				}
-
-				//printf("%i - %i - pred %i\n",int(p_ima_adpcm[i].last_nibble),int(nibble),int(p_ima_adpcm[i].predictor));
-			}
-		}
-
-		final = p_ima_adpcm[0].predictor;
-		if (is_stereo) {
-			final_r = p_ima_adpcm[1].predictor;
-		}
-
-		*dest = final;
-		dest++;
-		if (is_stereo) {
-			*dest = final_r;
-			dest++;
+	dest_data.resize_initialized(p_amount * sizeof(int16_t) * channels); // number of 16-bit samples * number of channels
+
+	IMA_ADPCM_Decoder decoder;
+	decoder.src = data.ptr();
+	decoder.dest = (int16_t *)dest_data.ptrw();
+	decoder.src_bytes_per_channel = data.size() / channels;
+	decoder.samples_per_channel = p_amount;
+	decoder.channels = channels;
+	if (is_stereo && p_amount >= MIN_SAMPLES_FOR_MULTITHREAD && Thread::is_main_thread()) {
+		auto group_id = WorkerThreadPool::get_singleton()->add_template_group_task(
+				&decoder, &IMA_ADPCM_Decoder::decode_channel, (void *)nullptr, channels, -1, true, SNAME("SampleExporter::convert_adpcm_to_16bit"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_id);
+	} else {
+		for (int i = 0; i < channels; i++) {
+			decoder.decode_channel(i);
 		}
-		p_offset += p_increment;
 	}
 	new_sample->set_data(dest_data);
 	return new_sample;
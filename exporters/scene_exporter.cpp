@@ -2994,6 +2994,25 @@ Error _check_cancelled() {
 	return OK;
 }
 
+// Orders a batch of scenes by their dependency graph, and keeps dependencies shared between scenes
+// loaded until the last scene that uses them has been exported, so they aren't reloaded for every scene.
+struct SceneDependencyScheduler {
+	Mutex mutex;
+	// dependency path -> number of scenes not yet exported that depend on it
+	HashMap<String, int64_t> remaining_dependents;
+	HashMap<String, Ref<Resource>> kept_loaded;
+	int64_t max_kept_loaded = 0;
+	int64_t total_kept_loaded = 0;
+	int64_t peak_kept_loaded = 0;
+
+	static String get_dependency_path(const String &p_dep);
+	void _get_dependencies_task(uint32_t i, std::shared_ptr<BatchExportToken> *tokens);
+	String _get_dependencies_description(uint32_t i, std::shared_ptr<BatchExportToken> *tokens);
+	void schedule(Vector<std::shared_ptr<BatchExportToken>> &tokens);
+	void release(const Vector<String> &p_dependencies, const Vector<String> &p_own_paths, bool p_keep_loaded);
+	void clear();
+};
+
 struct BatchExportToken : public TaskRunnerStruct {
 	static std::atomic<int64_t> in_progress;
 	GLBExporterInstance instance;
@@ -3015,6 +3034,10 @@ struct BatchExportToken : public TaskRunnerStruct {
 	int64_t export_start_time = 0;
 	int64_t export_end_time = 0;
 	size_t surface_count = 0;
+	// paths other scenes may refer to this one by
+	Vector<String> own_paths;
+	Vector<String> dependencies;
+	SceneDependencyScheduler *dep_scheduler = nullptr;
 
 	BatchExportToken(const String &p_output_dir, const Ref<ImportInfo> &p_iinfo, Dictionary p_options = {}, bool p_is_batch_export = false) :
 			instance(p_output_dir, p_options, true) {
@@ -3035,9 +3058,19 @@ struct BatchExportToken : public TaskRunnerStruct {
 		scene_size = FileAccess::get_size(p_iinfo->get_path());
 		output_dir = p_output_dir;
 		p_src_path = p_iinfo->get_path();
+		own_paths.push_back(p_src_path);
+		if (p_iinfo->get_source_file() != p_src_path) {
+			own_paths.push_back(p_iinfo->get_source_file());
+		}
 		set_export_dest(new_path);
 	}
 
+	void release_dependencies(bool p_keep_loaded) {
+		if (dep_scheduler) {
+			dep_scheduler->release(dependencies, own_paths, p_keep_loaded);
+		}
+	}
+
 	void set_export_dest(const String &p_export_dest) {
 		report->get_import_info()->set_export_dest(p_export_dest);
 		p_dest_path = output_dir.path_join(p_export_dest.replace("res://", ""));
@@ -3190,6 +3223,7 @@ struct BatchExportToken : public TaskRunnerStruct {
 				memdelete(root);
 				root = nullptr;
 			}
+			release_dependencies(false);
 			_scene = nullptr;
 			report->set_error(err);
 			export_done = true;
@@ -3220,6 +3254,8 @@ struct BatchExportToken : public TaskRunnerStruct {
 				report->set_saved_path(p_dest_path);
 			}
 		}
+		// must be done before we drop the scene, otherwise the dependencies will already be freed
+		release_dependencies(true);
 		_scene = nullptr;
 		// print_line("Finished exporting scene " + p_src_path);
 		report->set_error(err);
@@ -3459,6 +3495,195 @@ String SceneExporter::get_batch_export_description(int i, std::shared_ptr<BatchE
 	return "Exporting scene " + tokens[i]->p_src_path;
 }
 
+String SceneDependencyScheduler::get_dependency_path(const String &p_dep) {
+	// either "path", "path::type", or "uid::type::fallback_path"
+	auto splits = p_dep.split("::");
+	String path = splits[0];
+	if (splits.size() == 3) {
+		path = splits[2];
+	}
+	if (splits[0].begins_with("uid://")) {
+		ResourceUID::ID uid = ResourceUID::get_singleton()->text_to_id(splits[0]);
+		if (uid != ResourceUID::INVALID_ID && ResourceUID::get_singleton()->has_id(uid)) {
+			path = ResourceUID::get_singleton()->get_id_path(uid);
+		} else if (splits.size() != 3) {
+			path = "";
+		}
+	}
+	return path;
+}
+
+void SceneDependencyScheduler::_get_dependencies_task(uint32_t i, std::shared_ptr<BatchExportToken> *tokens) {
+	auto &token = tokens[i];
+	// the report keeps the raw dependency list, so rewriting the metadata later doesn't have to read it again
+	if (token->report->dependencies.is_empty()) {
+		List<String> deps;
+		ResourceCompatLoader::get_dependencies(token->p_src_path, &deps, false);
+		for (const String &dep : deps) {
+			token->report->dependencies.push_back(dep);
+		}
+	}
+	for (const String &dep : token->report->dependencies) {
+		String path = get_dependency_path(dep);
+		if (!path.is_empty() && !token->dependencies.has(path)) {
+			token->dependencies.push_back(path);
+		}
+	}
+}
+
+String SceneDependencyScheduler::_get_dependencies_description(uint32_t i, std::shared_ptr<BatchExportToken> *tokens) {
+	return "Scanning dependencies of " + tokens[i]->p_src_path;
+}
+
+namespace {
+struct SceneScheduleEntry {
+	String cluster_key;
+	int64_t index = 0;
+
+	bool operator<(const SceneScheduleEntry &p_other) const {
+		// scenes without shared dependencies go last
+		if (cluster_key.is_empty() != p_other.cluster_key.is_empty()) {
+			return !cluster_key.is_empty();
+		}
+		if (cluster_key != p_other.cluster_key) {
+			return cluster_key < p_other.cluster_key;
+		}
+		return index < p_other.index;
+	}
+};
+} //namespace
+
+void SceneDependencyScheduler::schedule(Vector<std::shared_ptr<BatchExportToken>> &tokens) {
+	Error err = TaskManager::get_singleton()->run_multithreaded_group_task(
+			this,
+			&SceneDependencyScheduler::_get_dependencies_task,
+			tokens.ptrw(),
+			tokens.size(),
+			&SceneDependencyScheduler::_get_dependencies_description,
+			"SceneDependencyScheduler::schedule",
+			"Scanning scene dependencies...",
+			true, -1, true, nullptr, 0, false);
+	if (err != OK) {
+		// keep the original order
+		return;
+	}
+
+	HashMap<String, int64_t> scene_indices;
+	for (int64_t i = 0; i < tokens.size(); i++) {
+		for (const String &path : tokens[i]->own_paths) {
+			scene_indices[path] = i;
+		}
+		for (const String &dep : tokens[i]->dependencies) {
+			remaining_dependents[dep] = remaining_dependents.has(dep) ? remaining_dependents[dep] + 1 : 1;
+		}
+	}
+
+	// group scenes by their most widely shared dependency so that scenes sharing it are exported back-to-back
+	Vector<SceneScheduleEntry> entries;
+	entries.resize(tokens.size());
+	for (int64_t i = 0; i < tokens.size(); i++) {
+		int64_t best_count = 1;
+		String best;
+		for (const String &dep : tokens[i]->dependencies) {
+			int64_t count = remaining_dependents[dep];
+			if (count > best_count || (count == best_count && count > 1 && dep < best)) {
+				best_count = count;
+				best = dep;
+			}
+		}
+		entries.write[i] = { best, i };
+	}
+	entries.sort();
+
+	// post-order DFS, so that instanced scenes are exported (and kept loaded) before the scenes that instance them
+	Vector<std::shared_ptr<BatchExportToken>> ordered;
+	Vector<uint8_t> visited;
+	visited.resize_initialized(tokens.size());
+	Vector<Pair<int64_t, int64_t>> stack;
+	for (const auto &entry : entries) {
+		if (visited[entry.index]) {
+			continue;
+		}
+		visited.write[entry.index] = 1;
+		stack.push_back({ entry.index, 0 });
+		while (!stack.is_empty()) {
+			auto &top = stack.write[stack.size() - 1];
+			const auto &deps = tokens[top.first]->dependencies;
+			bool pushed = false;
+			while (top.second < deps.size()) {
+				auto *dep_index = scene_indices.getptr(deps[top.second++]);
+				if (dep_index && !visited[*dep_index]) {
+					visited.write[*dep_index] = 1;
+					stack.push_back({ *dep_index, 0 });
+					pushed = true;
+					break;
+				}
+			}
+			if (!pushed) {
+				ordered.push_back(tokens[stack[stack.size() - 1].first]);
+				stack.resize(stack.size() - 1);
+			}
+		}
+	}
+	tokens = ordered;
+}
+
+void SceneDependencyScheduler::release(const Vector<String> &p_dependencies, const Vector<String> &p_own_paths, bool p_keep_loaded) {
+	// freeing a resource can cascade into freeing its whole subtree; to_release is destroyed after the lock is dropped
+	HashMap<String, Ref<Resource>> to_release;
+	MutexLock lock(mutex);
+	bool keep = p_keep_loaded && max_kept_loaded > 0 && !TaskManager::is_memory_usage_too_high();
+	auto keep_loaded = [&](const String &p_path) {
+		if (!keep || kept_loaded.has(p_path) || (int64_t)kept_loaded.size() >= max_kept_loaded) {
+			return;
+		}
+		Ref<Resource> res = ResourceCache::get_ref(p_path);
+		if (res.is_valid()) {
+			kept_loaded[p_path] = res;
+			total_kept_loaded++;
+		}
+	};
+	for (const String &dep : p_dependencies) {
+		int64_t *remaining = remaining_dependents.getptr(dep);
+		if (!remaining) {
+			continue;
+		}
+		(*remaining)--;
+		if (*remaining <= 0) {
+			// last dependent is done, let it be freed
+			remaining_dependents.erase(dep);
+			Ref<Resource> *res = kept_loaded.getptr(dep);
+			if (res) {
+				to_release[dep] = *res;
+				kept_loaded.erase(dep);
+			}
+		} else {
+			keep_loaded(dep);
+		}
+	}
+	// the scene itself may be instanced by scenes that haven't been exported yet
+	for (const String &path : p_own_paths) {
+		if (remaining_dependents.has(path)) {
+			keep_loaded(path);
+		}
+	}
+	if (p_keep_loaded && !keep) {
+		// memory pressure; drop everything and just reload as needed
+		for (auto &E : kept_loaded) {
+			to_release[E.key] = E.value;
+		}
+		kept_loaded.clear();
+	}
+	peak_kept_loaded = MAX(peak_kept_loaded, (int64_t)kept_loaded.size());
+}
+
+void SceneDependencyScheduler::clear() {
+	HashMap<String, Ref<Resource>> to_release;
+	MutexLock lock(mutex);
+	SWAP(to_release, kept_loaded);
+	remaining_dependents.clear();
+}
+
 struct BatchExportTokenSort {
 	bool operator()(const std::shared_ptr<BatchExportToken> &a, const std::shared_ptr<BatchExportToken> &b) const {
 		return a->export_end_time - a->export_start_time > b->export_end_time - b->export_start_time;
@@ -3547,6 +3772,15 @@ Vector<Ref<ExportReport>> SceneExporter::batch_export_files(const String &output
 		return reports;
 	}
 
+	SceneDependencyScheduler dep_scheduler;
+	dep_scheduler.max_kept_loaded = GDREConfig::get_singleton()->get_setting("Exporter/Scene/max_shared_dependencies_kept_loaded", 256);
+	if (tokens.size() > 1) {
+		dep_scheduler.schedule(tokens);
+		for (auto &token : tokens) {
+			token->dep_scheduler = &dep_scheduler;
+		}
+	}
+
 	bool remove_physics_bodies = GDREConfig::get_singleton()->get_setting("Exporter/Scene/GLTF/remove_physics_bodies", false);
 	if (remove_physics_bodies) {
 		unregister_physics_extension();
@@ -3717,6 +3951,8 @@ Vector<Ref<ExportReport>> SceneExporter::batch_export_files(const String &output
 		perf_print(vformat("Average time to get VRAM usage: %.02fms", (double)average_delta / 1000.0));
 		perf_print(vformat("Peak VRAM usage: %.02fMB", (double)peak_vram_usage / (double)ONE_MB));
 	}
+	perf_print(vformat("Kept %d shared scene dependencies loaded between scenes (peak %d at once)", dep_scheduler.total_kept_loaded, dep_scheduler.peak_kept_loaded));
+	dep_scheduler.clear();
 	perf_print("\n");
 	auto export_end_time = OS::get_singleton()->get_ticks_msec();
 	tokens.sort_custom<BatchExportTokenSort>();
@@ -18,12 +18,40 @@
 #include "utility/resource_info.h"
 #include <cstdint>
 namespace {
-bool get_bit(const Vector<uint8_t> &bitmask, int width, int p_x, int p_y) {
-	int ofs = width * p_y + p_x;
-	int bbyte = ofs / 8;
-	int bbit = ofs % 8;
+struct BitExpandTable {
+	// Each byte of the bitmask expanded to 8 L8 pixels (0x00 or 0xFF), LSB first
+	uint64_t table[256];
+	BitExpandTable() {
+		for (int i = 0; i < 256; i++) {
+			uint64_t v = 0;
+			for (int bit = 0; bit < 8; bit++) {
+				if (i & (1 << bit)) {
+					v |= uint64_t(0xFF) << (bit * 8);
+				}
+			}
+			table[i] = BitExpandTable::to_le(v);
+		}
+	}
+	static uint64_t to_le(uint64_t v) {
+#ifdef BIG_ENDIAN_ENABLED
+		return BSWAP64(v);
+#else
+		return v;
+#endif
+	}
+};
 
-	return (bitmask[bbyte] & (1 << bbit)) != 0;
+// BitMap data is row-major with one bit per pixel, which is the same order as L8 pixel data
+void unpack_bitmap_to_l8(const uint8_t *p_bits, int64_t p_bits_size, int64_t p_pixel_count, uint8_t *r_dst) {
+	static const BitExpandTable expand;
+	int64_t full_bytes = MIN(p_pixel_count / 8, p_bits_size);
+	for (int64_t i = 0; i < full_bytes; i++) {
+		memcpy(r_dst + i * 8, &expand.table[p_bits[i]], 8);
+	}
+	for (int64_t px = full_bytes * 8; px < p_pixel_count; px++) {
+		int64_t bbyte = px / 8;
+		r_dst[px] = bbyte < p_bits_size && (p_bits[bbyte] & (1 << (px % 8))) ? 0xFF : 0;
+	}
 }
 } //namespace
 
@@ -53,15 +81,15 @@ Ref<Image> TextureExporter::load_image_from_bitmap(const String p_path, Error *r
 	size = data.get("size", Vector2());
 	width = size.width;
 	height = size.height;
-	image->initialize_data(width, height, false, Image::FORMAT_L8);
 
 	if (!name.is_empty()) {
 		image->set_name(name);
 	}
-	for (int i = 0; i < width; i++) {
-		for (int j = 0; j < height; j++) {
-			image->set_pixel(i, j, get_bit(bitmask, width, i, j) ? Color(1, 1, 1) : Color(0, 0, 0));
-		}
+	{
+		Vector<uint8_t> pixels;
+		pixels.resize(int64_t(width) * height);
+		unpack_bitmap_to_l8(bitmask.ptr(), bitmask.size(), pixels.size(), pixels.ptrw());
+		image->set_data(width, height, false, Image::FORMAT_L8, pixels);
 	}
 	ERR_FAIL_COND_V_MSG(image.is_null() || image->is_empty(), Ref<Image>(), "Failed to load image from " + p_path);
 	*r_err = OK;
@@ -1201,20 +1229,125 @@ String TextureExporter::get_default_export_extension(const String &res_path) con
 	return "png";
 }
 namespace {
-Error check_image_colors(const Ref<Image> &original_image, const Ref<Image> &exported_image) {
-	Error _ret_err = OK;
-	for (int64_t x = 0; x < original_image->get_width(); x++) {
-		for (int64_t y = 0; y < original_image->get_height(); y++) {
-			Color original_image_color = original_image->get_pixel(x, y);
-			Color exported_image_color = exported_image->get_pixel(x, y);
-			if (original_image_color != exported_image_color) {
-				GDRE_CHECK_EQ(original_image_color.a, 0.0);
-				GDRE_CHECK_EQ(original_image_color.a, exported_image_color.a);
-			} else {
-				GDRE_CHECK_EQ(original_image_color, exported_image_color);
+struct ImageCompareResult {
+	int64_t mismatch_count = 0;
+	int64_t first_mismatch = -1; // pixel index
+};
+
+bool is_8bit_format(Image::Format p_format) {
+	switch (p_format) {
+		case Image::FORMAT_L8:
+		case Image::FORMAT_LA8:
+		case Image::FORMAT_R8:
+		case Image::FORMAT_RG8:
+		case Image::FORMAT_RGB8:
+		case Image::FORMAT_RGBA8:
+			return true;
+		default:
+			break;
+	}
+	return false;
+}
+
+// Pixels that differ only where both are fully transparent are not mismatches
+template <int CHANNELS, int ALPHA_CHANNEL>
+void compare_pixels_8bit(const uint8_t *p_a, const uint8_t *p_b, int64_t p_pixel_count, bool p_early_exit, ImageCompareResult &r_result) {
+	// Compare in blocks so that identical runs are skipped with a single memcmp
+	constexpr int64_t BLOCK_PIXELS = 4096;
+	for (int64_t block_start = 0; block_start < p_pixel_count; block_start += BLOCK_PIXELS) {
+		int64_t block_end = MIN(block_start + BLOCK_PIXELS, p_pixel_count);
+		if (memcmp(p_a + block_start * CHANNELS, p_b + block_start * CHANNELS, (block_end - block_start) * CHANNELS) == 0) {
+			continue;
+		}
+		for (int64_t px = block_start; px < block_end; px++) {
+			const uint8_t *a = p_a + px * CHANNELS;
+			const uint8_t *b = p_b + px * CHANNELS;
+			if (memcmp(a, b, CHANNELS) == 0) {
+				continue;
+			}
+			if constexpr (ALPHA_CHANNEL >= 0) {
+				if (a[ALPHA_CHANNEL] == 0 && b[ALPHA_CHANNEL] == 0) {
+					continue;
+				}
+			}
+			if (r_result.first_mismatch < 0) {
+				r_result.first_mismatch = px;
+			}
+			r_result.mismatch_count++;
+			if (p_early_exit) {
+				return;
 			}
 		}
 	}
+}
+
+ImageCompareResult compare_image_data(const Ref<Image> &p_a, const Ref<Image> &p_b, bool p_early_exit) {
+	ImageCompareResult result;
+	int64_t pixel_count = int64_t(p_a->get_width()) * p_a->get_height();
+	Ref<Image> a = p_a;
+	Ref<Image> b = p_b;
+	if (a->get_format() != b->get_format() || !is_8bit_format(a->get_format())) {
+		if (!is_8bit_format(a->get_format()) || !is_8bit_format(b->get_format())) {
+			// Non-8 bit formats go through Color
+			for (int64_t px = 0; px < pixel_count; px++) {
+				int x = px % a->get_width();
+				int y = px / a->get_width();
+				Color ca = a->get_pixel(x, y);
+				Color cb = b->get_pixel(x, y);
+				if (ca == cb || (ca.a == 0 && cb.a == 0)) {
+					continue;
+				}
+				if (result.first_mismatch < 0) {
+					result.first_mismatch = px;
+				}
+				result.mismatch_count++;
+				if (p_early_exit) {
+					break;
+				}
+			}
+			return result;
+		}
+		a = p_a->duplicate();
+		a->convert(Image::FORMAT_RGBA8);
+		b = p_b->duplicate();
+		b->convert(Image::FORMAT_RGBA8);
+	}
+	// only the first mipmap is compared
+	const uint8_t *a_ptr = a->ptr();
+	const uint8_t *b_ptr = b->ptr();
+	switch (a->get_format()) {
+		case Image::FORMAT_L8:
+		case Image::FORMAT_R8:
+			compare_pixels_8bit<1, -1>(a_ptr, b_ptr, pixel_count, p_early_exit, result);
+			break;
+		case Image::FORMAT_LA8:
+			compare_pixels_8bit<2, 1>(a_ptr, b_ptr, pixel_count, p_early_exit, result);
+			break;
+		case Image::FORMAT_RG8:
+			compare_pixels_8bit<2, -1>(a_ptr, b_ptr, pixel_count, p_early_exit, result);
+			break;
+		case Image::FORMAT_RGB8:
+			compare_pixels_8bit<3, -1>(a_ptr, b_ptr, pixel_count, p_early_exit, result);
+			break;
+		case Image::FORMAT_RGBA8:
+			compare_pixels_8bit<4, 3>(a_ptr, b_ptr, pixel_count, p_early_exit, result);
+			break;
+		default:
+			break;
+	}
+	return result;
+}
+
+Error check_image_colors(const Ref<Image> &original_image, const Ref<Image> &exported_image) {
+	Error _ret_err = OK;
+	GDRE_REQUIRE(original_image->get_width() == exported_image->get_width() && original_image->get_height() == exported_image->get_height());
+	ImageCompareResult result = compare_image_data(original_image, exported_image, false);
+	if (result.mismatch_count > 0) {
+		int x = result.first_mismatch % original_image->get_width();
+		int y = result.first_mismatch / original_image->get_width();
+		ERR_PRINT(vformat("Image mismatch: %d pixels differ, first at (%d, %d): %s != %s", result.mismatch_count, x, y, original_image->get_pixel(x, y), exported_image->get_pixel(x, y)));
+	}
+	GDRE_CHECK_EQ(result.mismatch_count, 0);
 	return _ret_err;
 }
 } //namespace
@@ -24,5 +24,7 @@ public:
 	virtual void get_handled_importers(List<String> *out) const override;
 	virtual String get_name() const override;
 	virtual String get_default_export_extension(const String &res_path) const override;
+	// images are decompressed/converted in place on the loaded textures
+	virtual bool uses_shared_resource_cache() const override { return false; }
 	virtual Error test_export(const Ref<ExportReport> &export_report, const String &original_project_dir) const override;
 };
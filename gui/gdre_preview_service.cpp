@@ -0,0 +1,460 @@
+#include "gdre_preview_service.h"
+
+#include "compat/fake_gdscript.h"
+#include "compat/resource_cache_compat.h"
+#include "compat/resource_loader_compat.h"
+#include "core/io/image.h"
+#include "core/io/image_loader.h"
+#include "core/os/os.h"
+#include "scene/resources/texture.h"
+#include "utility/gdre_config.h"
+
+#include <chrono>
+
+GDREPreviewService *GDREPreviewService::singleton = nullptr;
+
+String GDREPreviewService::generate_source(const String &p_path, int p_bytecode_revision, String &r_error) {
+	Ref<FakeGDScript> script;
+	script.instantiate();
+	if (p_bytecode_revision != 0) {
+		script->set_override_bytecode_revision(p_bytecode_revision);
+	}
+	script->load_source_code(p_path);
+	r_error = script->get_error_message();
+	if (!r_error.is_empty()) {
+		return String();
+	}
+	return script->get_source_code();
+}
+
+Ref<Image> GDREPreviewService::generate_thumbnail(const String &p_path, int p_max_size, String &r_error) {
+	Ref<Image> image;
+	String ext = p_path.get_extension().to_lower();
+	if (ext != "image" && ImageLoader::recognize(ext)) {
+		image = Image::load_from_file(p_path);
+	} else {
+		// the loaded texture's image may be shared, so don't let the export cache hand it to anyone else
+		ResourceCacheCompat::Bypass bypass;
+		Ref<Resource> res = ResourceCompatLoader::non_global_load(p_path);
+		Ref<Texture2D> tex = res;
+		if (tex.is_valid()) {
+			image = tex->get_image();
+		} else {
+			image = res;
+		}
+	}
+	if (image.is_null() || image->is_empty()) {
+		r_error = "Failed to load image from " + p_path;
+		return Ref<Image>();
+	}
+	image = image->duplicate();
+	if (image->is_compressed() && image->decompress() != OK) {
+		r_error = "Failed to decompress image from " + p_path;
+		return Ref<Image>();
+	}
+	image->clear_mipmaps();
+	int width = image->get_width();
+	int height = image->get_height();
+	if (p_max_size > 0 && (width > p_max_size || height > p_max_size)) {
+		if (width >= height) {
+			height = MAX(1, height * p_max_size / width);
+			width = p_max_size;
+		} else {
+			width = MAX(1, width * p_max_size / height);
+			height = p_max_size;
+		}
+		image->resize(width, height, Image::INTERPOLATE_BILINEAR);
+	}
+	return image;
+}
+
+String GDREPreviewService::_get_cache_key(PreviewKind p_kind, const String &p_path, int p_arg, uint64_t p_generation) {
+	return itos(p_generation) + ":" + itos(p_kind) + ":" + itos(p_arg) + ":" + p_path;
+}
+
+int64_t GDREPreviewService::_estimate_size(const Variant &p_value) {
+	if (p_value.get_type() == Variant::STRING) {
+		return (int64_t)String(p_value).length() * sizeof(char32_t);
+	}
+	Ref<Image> image = p_value;
+	if (image.is_valid()) {
+		return image->get_data_size();
+	}
+	return 0;
+}
+
+bool GDREPreviewService::_cache_get(const String &p_key, Variant &r_value) {
+	auto *E = cache_entries.getptr(p_key);
+	if (!E) {
+		cache_misses++;
+		return false;
+	}
+	cache_lru.move_to_front(*E);
+	r_value = (*E)->get().value;
+	cache_hits++;
+	return true;
+}
+
+void GDREPreviewService::_cache_put(const String &p_key, const Variant &p_value) {
+	int64_t size = _estimate_size(p_value);
+	if (size > cache_max_size) {
+		return;
+	}
+	auto *E = cache_entries.getptr(p_key);
+	if (E) {
+		cache_size -= (*E)->get().size;
+		cache_lru.erase(*E);
+		cache_entries.erase(p_key);
+	}
+	_evict_to(cache_max_size - size);
+	cache_entries.insert(p_key, cache_lru.push_front({ p_key, p_value, size }));
+	cache_size += size;
+}
+
+void GDREPreviewService::_evict_to(int64_t p_size) {
+	while (cache_size > p_size && cache_lru.size() > 0) {
+		auto *E = cache_lru.back();
+		cache_size -= E->get().size;
+		cache_entries.erase(E->get().key);
+		cache_lru.erase(E);
+	}
+}
+
+int64_t GDREPreviewService::_get_configured_cache_max_size() {
+	return (int64_t)GDREConfig::get_singleton()->get_setting("Preview/preview_cache_size_mb", 64) * 1024 * 1024;
+}
+
+void GDREPreviewService::_ensure_started() {
+	if (running) {
+		return;
+	}
+	running = true;
+	if (cache_max_size < 0) {
+		cache_max_size = _get_configured_cache_max_size();
+	}
+	int worker_count = CLAMP((int)GDREConfig::get_singleton()->get_setting("Preview/preview_worker_threads", 2), 1, OS::get_singleton()->get_processor_count());
+	for (int i = 0; i < worker_count; i++) {
+		Thread *thread = memnew(Thread);
+		thread->start(_worker_func, this);
+		workers.push_back(thread);
+	}
+}
+
+void GDREPreviewService::_stop() {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		running = false;
+		for (int64_t id : queue) {
+			requests[id].status = STATUS_CANCELLED;
+		}
+		queue.clear();
+	}
+	queue_cv.notify_all();
+	done_cv.notify_all();
+	for (Thread *thread : workers) {
+		thread->wait_to_finish();
+		memdelete(thread);
+	}
+	workers.clear();
+}
+
+// Highest priority first, then the most recent request.
+int64_t GDREPreviewService::_pop_next() {
+	int best = 0;
+	for (int i = 1; i < queue.size(); i++) {
+		const Request &candidate = requests[queue[i]];
+		const Request &current = requests[queue[best]];
+		if (candidate.priority > current.priority || (candidate.priority == current.priority && candidate.id > current.id)) {
+			best = i;
+		}
+	}
+	int64_t id = queue[best];
+	queue.remove_at(best);
+	return id;
+}
+
+void GDREPreviewService::_finish(int64_t p_id) {
+	finished.push_back(p_id);
+	while (finished.size() > MAX_FINISHED_REQUESTS) {
+		requests.erase(finished.front()->get());
+		finished.pop_front();
+	}
+}
+
+void GDREPreviewService::_cancel_pending() {
+	Vector<int64_t> to_cancel;
+	for (auto &E : requests) {
+		if (E.value.status == STATUS_PENDING || E.value.status == STATUS_RUNNING) {
+			// running requests can't be interrupted; their results are still cached, but not delivered
+			E.value.status = STATUS_CANCELLED;
+			to_cancel.push_back(E.key);
+		}
+	}
+	for (int64_t id : to_cancel) {
+		_finish(id);
+	}
+	queue.clear();
+}
+
+int64_t GDREPreviewService::_request(PreviewKind p_kind, const String &p_path, int p_arg, int p_priority, bool p_cancel_pending) {
+	bool cached = false;
+	int64_t id;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		_ensure_started();
+		if (p_cancel_pending) {
+			_cancel_pending();
+		}
+		id = ++last_request_id;
+		Request request;
+		request.id = id;
+		request.kind = p_kind;
+		request.path = p_path;
+		request.arg = p_arg;
+		request.priority = p_priority;
+		request.generation = generation;
+		cached = _cache_get(_get_cache_key(p_kind, p_path, p_arg, generation), request.result);
+		if (cached) {
+			request.status = STATUS_DONE;
+			requests.insert(id, request);
+			_finish(id);
+		} else {
+			requests.insert(id, request);
+			queue.push_back(id);
+		}
+	}
+	if (cached) {
+		done_cv.notify_all();
+		callable_mp(this, &GDREPreviewService::_emit_preview_ready).call_deferred(id);
+	} else {
+		queue_cv.notify_one();
+	}
+	return id;
+}
+
+int64_t GDREPreviewService::request_source(const String &p_path, int p_bytecode_revision, int p_priority, bool p_cancel_pending) {
+	return _request(PREVIEW_SOURCE, p_path, p_bytecode_revision, p_priority, p_cancel_pending);
+}
+
+int64_t GDREPreviewService::request_thumbnail(const String &p_path, int p_max_size, int p_priority, bool p_cancel_pending) {
+	return _request(PREVIEW_THUMBNAIL, p_path, p_max_size, p_priority, p_cancel_pending);
+}
+
+void GDREPreviewService::cancel_request(int64_t p_id) {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		auto *request = requests.getptr(p_id);
+		if (!request || (request->status != STATUS_PENDING && request->status != STATUS_RUNNING)) {
+			return;
+		}
+		if (request->status == STATUS_PENDING) {
+			queue.erase(p_id);
+		}
+		request->status = STATUS_CANCELLED;
+		_finish(p_id);
+	}
+	done_cv.notify_all();
+}
+
+void GDREPreviewService::cancel_all_requests() {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		_cancel_pending();
+	}
+	done_cv.notify_all();
+}
+
+void GDREPreviewService::set_paused(bool p_paused) {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		paused = p_paused;
+	}
+	if (!p_paused) {
+		queue_cv.notify_all();
+	}
+}
+
+bool GDREPreviewService::is_paused() {
+	std::lock_guard<std::mutex> lock(mutex);
+	return paused;
+}
+
+void GDREPreviewService::pause_and_wait_idle() {
+	std::unique_lock<std::mutex> lock(mutex);
+	paused = true;
+	done_cv.wait(lock, [&]() { return active_count == 0; });
+}
+
+GDREPreviewService::RequestStatus GDREPreviewService::get_request_status(int64_t p_id) {
+	std::lock_guard<std::mutex> lock(mutex);
+	auto *request = requests.getptr(p_id);
+	return request ? request->status : STATUS_INVALID;
+}
+
+Dictionary GDREPreviewService::_request_to_dict(const Request &p_request) const {
+	Dictionary dict;
+	dict["status"] = p_request.status;
+	dict["kind"] = p_request.kind;
+	dict["path"] = p_request.path;
+	dict["result"] = p_request.status == STATUS_DONE ? p_request.result : Variant();
+	dict["error"] = p_request.error;
+	return dict;
+}
+
+Dictionary GDREPreviewService::get_request_result(int64_t p_id) {
+	std::lock_guard<std::mutex> lock(mutex);
+	auto *request = requests.getptr(p_id);
+	if (!request) {
+		Dictionary dict;
+		dict["status"] = STATUS_INVALID;
+		return dict;
+	}
+	return _request_to_dict(*request);
+}
+
+Dictionary GDREPreviewService::wait_for_request(int64_t p_id, int64_t p_timeout_msec) {
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		auto is_finished = [&]() {
+			auto *request = requests.getptr(p_id);
+			return !request || (request->status != STATUS_PENDING && request->status != STATUS_RUNNING);
+		};
+		if (p_timeout_msec < 0) {
+			done_cv.wait(lock, is_finished);
+		} else {
+			done_cv.wait_for(lock, std::chrono::milliseconds(p_timeout_msec), is_finished);
+		}
+	}
+	return get_request_result(p_id);
+}
+
+void GDREPreviewService::_worker_loop() {
+	while (true) {
+		Request request;
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			queue_cv.wait(lock, [&]() { return !running || (!paused && !queue.is_empty()); });
+			if (!running) {
+				return;
+			}
+			int64_t id = _pop_next();
+			requests[id].status = STATUS_RUNNING;
+			request = requests[id];
+			active_count++;
+		}
+
+		String error;
+		Variant result;
+		if (request.kind == PREVIEW_SOURCE) {
+			result = generate_source(request.path, request.arg, error);
+		} else {
+			result = generate_thumbnail(request.path, request.arg, error);
+		}
+
+		bool deliver = false;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			// the cache may have been cleared (e.g. the project was unloaded) while this was running
+			if (error.is_empty() && request.generation == generation) {
+				_cache_put(_get_cache_key(request.kind, request.path, request.arg, generation), result);
+			}
+			auto *current = requests.getptr(request.id);
+			if (current && current->status == STATUS_RUNNING) {
+				current->status = STATUS_DONE;
+				current->result = result;
+				current->error = error;
+				_finish(request.id);
+				deliver = true;
+			}
+			active_count--;
+		}
+		done_cv.notify_all();
+		if (deliver) {
+			callable_mp(this, &GDREPreviewService::_emit_preview_ready).call_deferred(request.id);
+		}
+	}
+}
+
+void GDREPreviewService::_worker_func(void *p_userdata) {
+	((GDREPreviewService *)p_userdata)->_worker_loop();
+}
+
+void GDREPreviewService::_emit_preview_ready(int64_t p_id) {
+	Dictionary result = get_request_result(p_id);
+	// a newer selection may have cancelled it in the meantime
+	if ((int)result["status"] != STATUS_DONE) {
+		return;
+	}
+	emit_signal(SNAME("preview_ready"), p_id, result["path"], result["kind"], result["result"], result["error"]);
+}
+
+void GDREPreviewService::clear_cache() {
+	std::lock_guard<std::mutex> lock(mutex);
+	generation++;
+	cache_lru.clear();
+	cache_entries.clear();
+	cache_size = 0;
+	cache_hits = 0;
+	cache_misses = 0;
+}
+
+void GDREPreviewService::set_cache_max_size(int64_t p_bytes) {
+	std::lock_guard<std::mutex> lock(mutex);
+	cache_max_size = p_bytes < 0 ? _get_configured_cache_max_size() : p_bytes;
+	_evict_to(cache_max_size);
+}
+
+int64_t GDREPreviewService::get_cache_max_size() {
+	std::lock_guard<std::mutex> lock(mutex);
+	return cache_max_size;
+}
+
+Dictionary GDREPreviewService::get_cache_stats() {
+	std::lock_guard<std::mutex> lock(mutex);
+	Dictionary stats;
+	stats["entries"] = cache_lru.size();
+	stats["size"] = cache_size;
+	stats["max_size"] = cache_max_size;
+	stats["hits"] = cache_hits;
+	stats["misses"] = cache_misses;
+	return stats;
+}
+
+void GDREPreviewService::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("request_source", "path", "bytecode_revision", "priority", "cancel_pending"), &GDREPreviewService::request_source, DEFVAL(0), DEFVAL(0), DEFVAL(true));
+	ClassDB::bind_method(D_METHOD("request_thumbnail", "path", "max_size", "priority", "cancel_pending"), &GDREPreviewService::request_thumbnail, DEFVAL(128), DEFVAL(0), DEFVAL(true));
+	ClassDB::bind_method(D_METHOD("cancel_request", "id"), &GDREPreviewService::cancel_request);
+	ClassDB::bind_method(D_METHOD("cancel_all_requests"), &GDREPreviewService::cancel_all_requests);
+	ClassDB::bind_method(D_METHOD("set_paused", "paused"), &GDREPreviewService::set_paused);
+	ClassDB::bind_method(D_METHOD("is_paused"), &GDREPreviewService::is_paused);
+	ClassDB::bind_method(D_METHOD("pause_and_wait_idle"), &GDREPreviewService::pause_and_wait_idle);
+	ClassDB::bind_method(D_METHOD("get_request_status", "id"), &GDREPreviewService::get_request_status);
+	ClassDB::bind_method(D_METHOD("get_request_result", "id"), &GDREPreviewService::get_request_result);
+	ClassDB::bind_method(D_METHOD("wait_for_request", "id", "timeout_msec"), &GDREPreviewService::wait_for_request, DEFVAL(-1));
+	ClassDB::bind_method(D_METHOD("clear_cache"), &GDREPreviewService::clear_cache);
+	ClassDB::bind_method(D_METHOD("set_cache_max_size", "bytes"), &GDREPreviewService::set_cache_max_size);
+	ClassDB::bind_method(D_METHOD("get_cache_max_size"), &GDREPreviewService::get_cache_max_size);
+	ClassDB::bind_method(D_METHOD("get_cache_stats"), &GDREPreviewService::get_cache_stats);
+
+	ADD_SIGNAL(MethodInfo("preview_ready", PropertyInfo(Variant::INT, "id"), PropertyInfo(Variant::STRING, "path"), PropertyInfo(Variant::INT, "kind"), PropertyInfo(Variant::NIL, "result", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NIL_IS_VARIANT), PropertyInfo(Variant::STRING, "error")));
+
+	BIND_ENUM_CONSTANT(PREVIEW_SOURCE);
+	BIND_ENUM_CONSTANT(PREVIEW_THUMBNAIL);
+
+	BIND_ENUM_CONSTANT(STATUS_INVALID);
+	BIND_ENUM_CONSTANT(STATUS_PENDING);
+	BIND_ENUM_CONSTANT(STATUS_RUNNING);
+	BIND_ENUM_CONSTANT(STATUS_DONE);
+	BIND_ENUM_CONSTANT(STATUS_CANCELLED);
+}
+
+GDREPreviewService::GDREPreviewService() {
+	singleton = this;
+}
+
+GDREPreviewService::~GDREPreviewService() {
+	_stop();
+	if (singleton == this) {
+		singleton = nullptr;
+	}
+}
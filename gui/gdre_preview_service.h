@@ -0,0 +1,136 @@
+#pragma once
+
+#include "core/object/object.h"
+#include "core/os/thread.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/list.h"
+#include "core/variant/dictionary.h"
+
+#include <condition_variable>
+#include <mutex>
+
+// Generates previews (decompiled script sources, texture thumbnails) for the GUI on a small pool of background threads.
+// Requests are prioritized, the most recent selection wins, and results are kept in a size-bounded LRU cache.
+// Results are delivered through the `preview_ready` signal on the main thread, or by blocking in wait_for_request().
+class GDREPreviewService : public Object {
+	GDCLASS(GDREPreviewService, Object);
+
+public:
+	enum PreviewKind {
+		PREVIEW_SOURCE,
+		PREVIEW_THUMBNAIL,
+	};
+
+	enum RequestStatus {
+		STATUS_INVALID,
+		STATUS_PENDING,
+		STATUS_RUNNING,
+		STATUS_DONE,
+		STATUS_CANCELLED,
+	};
+
+private:
+	static GDREPreviewService *singleton;
+	static constexpr int MAX_FINISHED_REQUESTS = 64;
+
+	struct Request {
+		int64_t id = 0;
+		PreviewKind kind = PREVIEW_SOURCE;
+		String path;
+		int priority = 0;
+		// bytecode revision for sources, maximum dimension for thumbnails
+		int arg = 0;
+		// cache generation when the request was made; results from an older generation aren't cached
+		uint64_t generation = 0;
+		RequestStatus status = STATUS_PENDING;
+		Variant result;
+		String error;
+	};
+
+	struct CacheEntry {
+		String key;
+		Variant value;
+		int64_t size = 0;
+	};
+
+	std::mutex mutex;
+	std::condition_variable queue_cv;
+	std::condition_variable done_cv;
+	bool running = false;
+	bool paused = false;
+	// requests a worker is generating right now, including ones that have been cancelled since they started
+	int active_count = 0;
+	Vector<Thread *> workers;
+	int64_t last_request_id = 0;
+	HashMap<int64_t, Request> requests;
+	Vector<int64_t> queue;
+	// finished (done or cancelled) requests, oldest first; trimmed to MAX_FINISHED_REQUESTS
+	List<int64_t> finished;
+
+	// front is the most recently used
+	List<CacheEntry> cache_lru;
+	HashMap<String, List<CacheEntry>::Element *> cache_entries;
+	int64_t cache_max_size = -1;
+	int64_t cache_size = 0;
+	// bumped by clear_cache(), so results computed from a project that has since been unloaded aren't cached
+	uint64_t generation = 0;
+	uint64_t cache_hits = 0;
+	uint64_t cache_misses = 0;
+
+	static String _get_cache_key(PreviewKind p_kind, const String &p_path, int p_arg, uint64_t p_generation);
+	static int64_t _get_configured_cache_max_size();
+	static int64_t _estimate_size(const Variant &p_value);
+	bool _cache_get(const String &p_key, Variant &r_value);
+	void _cache_put(const String &p_key, const Variant &p_value);
+	void _evict_to(int64_t p_size);
+
+	void _ensure_started();
+	void _stop();
+	int64_t _pop_next();
+	void _finish(int64_t p_id);
+	void _cancel_pending();
+	int64_t _request(PreviewKind p_kind, const String &p_path, int p_arg, int p_priority, bool p_cancel_pending);
+	Dictionary _request_to_dict(const Request &p_request) const;
+	void _worker_loop();
+	static void _worker_func(void *p_userdata);
+	void _emit_preview_ready(int64_t p_id);
+
+protected:
+	static void _bind_methods();
+
+public:
+	static GDREPreviewService *get_singleton() { return singleton; }
+
+	// Synchronous generators used by the workers; these do not touch the cache.
+	static String generate_source(const String &p_path, int p_bytecode_revision, String &r_error);
+	static Ref<Image> generate_thumbnail(const String &p_path, int p_max_size, String &r_error);
+
+	// Queues a request and returns its id. If `p_cancel_pending` is set, every request that has not finished yet is cancelled first.
+	int64_t request_source(const String &p_path, int p_bytecode_revision = 0, int p_priority = 0, bool p_cancel_pending = true);
+	int64_t request_thumbnail(const String &p_path, int p_max_size = 128, int p_priority = 0, bool p_cancel_pending = true);
+	void cancel_request(int64_t p_id);
+	void cancel_all_requests();
+	// While paused, queued requests aren't started; requests that are already running still finish.
+	void set_paused(bool p_paused);
+	bool is_paused();
+	// Pauses the queue and blocks until no worker is generating a preview; call set_paused(false) to resume.
+	// Used before removing the packs that running previews may be reading from.
+	void pause_and_wait_idle();
+	RequestStatus get_request_status(int64_t p_id);
+	// Returns {status, kind, path, result, error}; `result` is only set once the request is done.
+	Dictionary get_request_result(int64_t p_id);
+	// Blocks until the request finishes or the timeout elapses (-1 waits indefinitely).
+	Dictionary wait_for_request(int64_t p_id, int64_t p_timeout_msec = -1);
+
+	void clear_cache();
+	// A negative size goes back to the configured `Preview/preview_cache_size_mb`.
+	void set_cache_max_size(int64_t p_bytes);
+	int64_t get_cache_max_size();
+	Dictionary get_cache_stats();
+
+	GDREPreviewService();
+	~GDREPreviewService();
+};
+
+VARIANT_ENUM_CAST(GDREPreviewService::PreviewKind);
+VARIANT_ENUM_CAST(GDREPreviewService::RequestStatus);
@@ -512,14 +512,10 @@ Ref<EditorProgressGDDC> EditorProgressGDDC::create(Node *p_parent, const String
 }
 
 bool StdOutProgress::step(int p_step, bool p_force_refresh) {
-	const int prev_step = current_step;
-	if (p_step == -1) {
-		current_step++;
-	} else {
-		current_step = p_step;
-	}
+	const int prev_step = p_step == -1 ? current_step.fetch_add(1) : current_step.exchange(p_step);
+	const int new_step = p_step == -1 ? prev_step + 1 : p_step;
 	auto current_tick = OS::get_singleton()->get_ticks_usec();
-	float progress = MAX(0, (float)current_step / (float)amount);
+	float progress = MAX(0, (float)new_step / (float)amount);
 	size_t progress_percent = MIN(static_cast<size_t>(progress * 100), static_cast<size_t>(100));
 	size_t prev_progress_percent = MIN(static_cast<size_t>((static_cast<float>(prev_step) / static_cast<float>(amount)) * 100), static_cast<size_t>(100));
 	bool should_redraw = progress_percent != prev_progress_percent;
@@ -559,6 +555,19 @@ void EditorProgressGDDC::_bind_methods() {
 	ClassDB::bind_static_method(get_class_static(), D_METHOD("create", "parent", "task", "label", "amount", "can_cancel"), &EditorProgressGDDC::create, DEFVAL(false));
 }
 
+bool EditorProgressGDDC::shows_state() {
+	return !(GDRESettings::get_singleton() && GDRESettings::get_singleton()->is_headless());
+}
+
+bool EditorProgressGDDC::is_refresh_due(bool p_force_refresh) {
+	uint64_t current_tick = OS::get_singleton()->get_ticks_usec();
+	if (!p_force_refresh && current_tick - last_refresh_tick < REFRESH_INTERVAL_USEC) {
+		return false;
+	}
+	last_refresh_tick = current_tick;
+	return true;
+}
+
 bool EditorProgressGDDC::step(const String &p_state, int p_step, bool p_force_refresh) {
 	if (GDRESettings::get_singleton() && GDRESettings::get_singleton()->is_headless()) {
 		return stdout_progress.step(p_step, p_force_refresh);
@@ -603,7 +612,10 @@ EditorProgressGDDC::EditorProgressGDDC(const String &p_task, const String &p_lab
 		EditorProgressGDDC(nullptr, p_task, p_label, p_amount, p_can_cancel) {}
 EditorProgressGDDC::EditorProgressGDDC(Node *p_parent, const String &p_task, const String &p_label, int p_amount, bool p_can_cancel) {
 	task = p_task;
-	stdout_progress = { p_label, p_amount, 0, p_amount == -1 };
+	stdout_progress.label = p_label;
+	stdout_progress.amount = p_amount;
+	stdout_progress.current_step = 0;
+	stdout_progress.is_indeterminate = p_amount == -1;
 	if (GDRESettings::get_singleton() && GDRESettings::get_singleton()->is_headless()) {
 		return;
 	}
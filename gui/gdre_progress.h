@@ -41,6 +41,8 @@
 #include <utility/gd_parallel_hashmap.h>
 #include <utility/gd_parallel_queue.h>
 
+#include <atomic>
+
 class GDREBackgroundProgress : public HBoxContainer {
 	GDCLASS(GDREBackgroundProgress, HBoxContainer);
 
@@ -145,7 +147,7 @@ public:
 struct StdOutProgress {
 	String label;
 	int amount = 0;
-	int current_step = 0;
+	std::atomic<int> current_step = 0;
 	bool is_indeterminate = false;
 	uint16_t indeterminate_width = 0;
 	int width = 30;
@@ -167,8 +169,18 @@ public:
 	static Ref<EditorProgressGDDC> create(Node *p_parent, const String &p_task, const String &p_label, int p_amount, bool p_can_cancel = false);
 	String task;
 	StdOutProgress stdout_progress;
+
+	// Nothing redraws the progress more often than this, so there's no point in stepping it more often either.
+	static constexpr uint64_t REFRESH_INTERVAL_USEC = 50000;
+	std::atomic<uint64_t> last_refresh_tick = 0;
+
 	String get_task();
 	bool step(const String &p_state, int p_step = -1, bool p_force_refresh = true);
+
+	// Returns true (and restarts the interval) if the progress is due to be stepped again.
+	bool is_refresh_due(bool p_force_refresh = false);
+	// Whether the state text is shown at all; the CLI status bar only shows the label.
+	static bool shows_state();
 	void set_progress_length(bool p_indeterminate, int p_new_amount = -1);
 	EditorProgressGDDC();
 	EditorProgressGDDC(const String &p_task, const String &p_label, int p_amount, bool p_can_cancel = false);
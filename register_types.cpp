@@ -6,6 +6,7 @@
 #include "compat/fake_script.h"
 #include "core/object/class_db.h"
 #include "gui/gdre_audio_stream_preview.h"
+#include "gui/gdre_preview_service.h"
 #include "gui/gdre_progress.h"
 #include "gui/gdre_standalone.h"
 #include "modules/regex/regex.h"
@@ -84,6 +85,7 @@ void gdsdecomp_init_callback() {
 static GDRESettings *gdre_singleton = nullptr;
 static GDREAudioStreamPreviewGenerator *audio_stream_preview_generator = nullptr;
 static TaskManager *task_manager = nullptr;
+static GDREPreviewService *preview_service = nullptr;
 static GDREConfig *gdre_config = nullptr;
 // TODO: move this to its own thing
 static Ref<ResourceFormatLoaderCompatText> text_loader = nullptr;
@@ -480,6 +482,7 @@ void initialize_gdsdecomp_module(ModuleInitializationLevel p_level) {
 	ClassDB::register_class<GDREAudioStreamPreviewGeneratorNode>();
 	ClassDB::register_class<GDREAudioStreamPreviewGenerator>();
 	ClassDB::register_class<GDREAudioStreamPreview>();
+	ClassDB::register_class<GDREPreviewService>();
 
 	ClassDB::register_class<GDRECommon>();
 	ClassDB::register_class<TextDiff>();
@@ -512,6 +515,8 @@ void initialize_gdsdecomp_module(ModuleInitializationLevel p_level) {
 	Engine::get_singleton()->add_singleton(Engine::Singleton("GDREAudioStreamPreviewGenerator", GDREAudioStreamPreviewGenerator::get_singleton()));
 	task_manager = memnew(TaskManager);
 	Engine::get_singleton()->add_singleton(Engine::Singleton("TaskManager", TaskManager::get_singleton()));
+	preview_service = memnew(GDREPreviewService);
+	Engine::get_singleton()->add_singleton(Engine::Singleton("GDREPreviewService", GDREPreviewService::get_singleton()));
 #ifdef TOOLS_ENABLED
 	EditorNode::add_init_callback(&gdsdecomp_init_callback);
 #endif
@@ -524,6 +529,11 @@ void uninitialize_gdsdecomp_module(ModuleInitializationLevel p_level) {
 	if (p_level != MODULE_INITIALIZATION_LEVEL_SCENE) {
 		return;
 	}
+	// stop the preview workers before anything they use goes away
+	if (preview_service) {
+		memdelete(preview_service);
+		preview_service = nullptr;
+	}
 	uninitialize_etcpak_decompress_module(p_level);
 	deinit_exporters();
 	deinit_loaders();
@@ -0,0 +1,154 @@
+class_name GDREBatch
+extends RefCounted
+
+# Recovers several packs in one process, so the engine, loaders, exporters and worker pool are only initialized once.
+#
+# Manifest: a JSON array of entries, or {"packs": [...], "prefetch_mb": 0}. Each entry looks like
+#   {"input": "/games/a/game.pck", "output": "/out/a", "key": "<HEX_KEY>", "extract_only": false,
+#    "includes": ["res://**/*.gd"], "excludes": [], "ignore_checksum_errors": false, "skip_checksum_check": false,
+#    "csharp_assembly": "/games/a/data/Game.dll", "test_recovery": false, "test_output": ""}
+# `input` may also be an array of paths (e.g. a PCK plus its patches), or an extracted project directory.
+# `output` defaults to the same directory --recover/--extract would use.
+# `csharp_assembly` is the same as --csharp-assembly, and is auto-detected from the pack path if not set.
+# Relative paths are resolved against the manifest's directory. Every entry goes through the same recovery as --recover/--extract,
+# so include/exclude globs follow the same rules.
+#
+# Only one project can be loaded at a time, so packs are loaded sequentially. If "prefetch_mb" is set, up to that many MB of
+# the next entry's pack files are read in the background while the current one is exporting, so that its load hits the OS file
+# cache instead of the disk. A per-pack timing summary is printed at the end and written next to the manifest as <MANIFEST>_summary.json.
+
+const PREFETCH_CHUNK_SIZE = 4 * 1024 * 1024
+
+# the gdre_main.gd instance, which does the actual recovery
+var main = null
+var prefetch_limit: int = 0
+var prefetch_thread: Thread = null
+var prefetch_cancelled: bool = false
+
+func _init(p_main):
+	main = p_main
+
+func run(manifest_path: String) -> int:
+	var entries = _load_manifest(manifest_path)
+	if entries.is_empty():
+		print("Error: no packs to recover in manifest " + manifest_path)
+		return 1
+	var results: Array[Dictionary] = []
+	var batch_start = Time.get_ticks_msec()
+	for i in range(entries.size()):
+		print("\n[%d/%d] Recovering %s" % [i + 1, entries.size(), ", ".join(entries[i]["input"])])
+		if i + 1 < entries.size() and prefetch_limit > 0:
+			_start_prefetch(entries[i + 1]["input"])
+		results.append(_recover_entry(entries[i]))
+		_stop_prefetch()
+	_print_summary(results, Time.get_ticks_msec() - batch_start)
+	_save_summary(manifest_path.get_basename() + "_summary.json", results)
+	for result in results:
+		if result["error"] != 0:
+			return 1
+	return 0
+
+func _load_manifest(manifest_path: String) -> Array[Dictionary]:
+	var entries: Array[Dictionary] = []
+	var json = JSON.parse_string(FileAccess.get_file_as_string(manifest_path))
+	if typeof(json) == TYPE_DICTIONARY:
+		prefetch_limit = int(json.get("prefetch_mb", 0)) * 1024 * 1024
+		json = json.get("packs", [])
+	if typeof(json) != TYPE_ARRAY:
+		print("Error: failed to parse manifest " + manifest_path)
+		return entries
+	for item in json:
+		if typeof(item) != TYPE_DICTIONARY or not item.has("input"):
+			print("Error: invalid manifest entry: " + str(item))
+			return []
+		var entry: Dictionary = item.duplicate()
+		var input = entry["input"]
+		var input_files: PackedStringArray = []
+		for path in (PackedStringArray([input]) if typeof(input) == TYPE_STRING else PackedStringArray(input)):
+			input_files.append(_get_abs_path(path, manifest_path.get_base_dir()))
+		entry["input"] = input_files
+		# without an output, recovery() picks the same default as --recover/--extract
+		for key in ["output", "csharp_assembly", "test_output"]:
+			if not String(entry.get(key, "")).is_empty():
+				entry[key] = _get_abs_path(entry[key], manifest_path.get_base_dir())
+		entries.append(entry)
+	return entries
+
+func _get_abs_path(path: String, base_dir: String) -> String:
+	if path.is_absolute_path():
+		return path.simplify_path()
+	return base_dir.path_join(path).simplify_path()
+
+func _recover_entry(entry: Dictionary) -> Dictionary:
+	var input_files: PackedStringArray = entry["input"]
+	var output_dir: String = entry.get("output", "")
+	# error is recovery()'s exit code: 0 on success, 1 on failure, 2 if cancelled
+	var result = {"input": input_files, "output": output_dir, "error": 0, "files": 0, "load_ms": 0, "extract_ms": 0, "export_ms": 0, "total_ms": 0}
+	var start_time = Time.get_ticks_msec()
+	result["error"] = main.recovery(
+		input_files,
+		output_dir,
+		entry.get("key", ""),
+		entry.get("extract_only", false),
+		entry.get("ignore_checksum_errors", false),
+		PackedStringArray(entry.get("excludes", [])),
+		PackedStringArray(entry.get("includes", [])),
+		entry.get("skip_checksum_check", false),
+		entry.get("csharp_assembly", ""),
+		entry.get("test_recovery", false),
+		entry.get("test_output", ""),
+		result)
+	if GDRESettings.is_pack_loaded():
+		GDRESettings.unload_project()
+	# don't carry this pack's key over to the next one
+	GDRESettings.reset_encryption_key()
+	GDRESettings.close_log_file()
+	result["total_ms"] = Time.get_ticks_msec() - start_time
+	return result
+
+func _start_prefetch(input_files: PackedStringArray):
+	prefetch_cancelled = false
+	prefetch_thread = Thread.new()
+	prefetch_thread.start(_prefetch.bind(input_files))
+
+func _stop_prefetch():
+	if prefetch_thread == null:
+		return
+	prefetch_cancelled = true
+	prefetch_thread.wait_to_finish()
+	prefetch_thread = null
+
+# Reads up to prefetch_limit bytes of the pack files so the next load_project() doesn't wait on the disk; the data itself is discarded.
+func _prefetch(input_files: PackedStringArray):
+	var remaining = prefetch_limit
+	for path in input_files:
+		var f = FileAccess.open(path, FileAccess.READ)
+		if f == null:
+			continue
+		while not prefetch_cancelled and remaining > 0 and f.get_position() < f.get_length():
+			remaining -= f.get_buffer(mini(PREFETCH_CHUNK_SIZE, remaining)).size()
+		if prefetch_cancelled or remaining <= 0:
+			return
+
+func _print_summary(results: Array[Dictionary], batch_ms: int):
+	print("\nBatch summary:")
+	print("%-8s %10s %10s %10s %10s %8s  %s" % ["status", "load_ms", "extract_ms", "export_ms", "total_ms", "files", "input"])
+	var failed = 0
+	for result in results:
+		if result["error"] != 0:
+			failed += 1
+		print("%-8s %10d %10d %10d %10d %8d  %s" % [
+			"ok" if result["error"] == 0 else "FAILED",
+			result["load_ms"], result["extract_ms"], result["export_ms"], result["total_ms"], result["files"],
+			", ".join(result["input"])])
+	var secs_taken = batch_ms / 1000
+	print("%d/%d packs recovered in %02dm%02ds" % [results.size() - failed, results.size(), secs_taken / 60, secs_taken % 60])
+
+func _save_summary(summary_path: String, results: Array[Dictionary]):
+	var f = FileAccess.open(summary_path, FileAccess.WRITE)
+	if f == null:
+		print("Error: failed to write batch summary to " + summary_path)
+		return
+	f.store_string(JSON.stringify(results, "\t", false))
+	f.close()
+	print("Wrote batch summary to " + summary_path)
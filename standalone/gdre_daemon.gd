@@ -0,0 +1,201 @@
+class_name GDREDaemon
+extends RefCounted
+
+# Line-delimited JSON-RPC server over stdin/stdout.
+# Keeps the project loaded between requests so that subsequent queries against the same game skip `load_project`.
+#
+# Request:  {"id": 1, "method": "list", "params": {"filters": ["*.gd"]}}
+# Response: {"jsonrpc": "2.0", "id": 1, "result": {...}, "time_ms": 0.42}
+# Errors:   {"jsonrpc": "2.0", "id": 1, "error": {"code": <Error>, "message": "..."}, "time_ms": 0.1}
+#
+# Engine logs and progress bars share stdout with the responses, so responses are framed as RFC 7464 JSON text sequences:
+# each one is written as a record separator byte (0x1E) followed by the JSON text and a newline.
+# Clients should discard everything up to the 0x1E byte and parse the rest of that line.
+
+const STDIN_BUFFER_SIZE = 1 << 16
+const RECORD_SEPARATOR = 0x1E
+const NEWLINE = 0x0A
+
+var loaded_paths: PackedStringArray = []
+var loaded_key: String = ""
+var running: bool = false
+
+func run() -> int:
+	running = true
+	_send({"jsonrpc": "2.0", "id": null, "result": {"ready": true, "version": GDRESettings.get_gdre_version()}})
+	while running:
+		var line = _read_line()
+		if line == null:
+			break
+		line = line.strip_edges()
+		if line.is_empty():
+			continue
+		_handle_line(line)
+	_unload()
+	return 0
+
+# Returns the next line from stdin without its newline, or null once stdin is closed.
+func _read_line():
+	# read_string_from_stdin() strips the newline, so a blank line looks the same as EOF; read the first byte raw to tell them apart.
+	var first: PackedByteArray = OS.read_buffer_from_stdin(1)
+	if first.is_empty():
+		return null
+	if first[0] == NEWLINE:
+		return ""
+	var line: PackedByteArray = first
+	while true:
+		# reads up to STDIN_BUFFER_SIZE - 1 bytes; a chunk that fills the buffer means the line continues
+		var chunk: PackedByteArray = OS.read_string_from_stdin(STDIN_BUFFER_SIZE).to_utf8_buffer()
+		line.append_array(chunk)
+		if chunk.size() < STDIN_BUFFER_SIZE - 1:
+			break
+	return line.get_string_from_utf8()
+
+func _send(response: Dictionary):
+	print(String.chr(RECORD_SEPARATOR) + JSON.stringify(response))
+
+func _handle_line(line: String):
+	var start_time = Time.get_ticks_usec()
+	var request = JSON.parse_string(line)
+	var response = {"jsonrpc": "2.0", "id": null}
+	if typeof(request) != TYPE_DICTIONARY or not request.has("method"):
+		response["error"] = {"code": ERR_PARSE_ERROR, "message": "Invalid request"}
+	else:
+		response["id"] = request.get("id", null)
+		var params = request.get("params", {})
+		if typeof(params) != TYPE_DICTIONARY:
+			params = {}
+		var result = _dispatch(String(request["method"]), params)
+		if result.has("error"):
+			response["error"] = result["error"]
+		else:
+			response["result"] = result
+	response["time_ms"] = (Time.get_ticks_usec() - start_time) / 1000.0
+	_send(response)
+
+func _error(code: int, message: String) -> Dictionary:
+	return {"error": {"code": code, "message": message}}
+
+func _dispatch(method: String, params: Dictionary) -> Dictionary:
+	match method:
+		"ping":
+			return {"pong": true}
+		"load":
+			return _load(params)
+		"unload":
+			_unload()
+			return {"unloaded": true}
+		"list":
+			return _list(params)
+		"extract":
+			return _extract(params)
+		"decompile":
+			return _decompile(params)
+		"export":
+			return _export(params)
+		"quit":
+			running = false
+			return {"quit": true}
+	return _error(ERR_METHOD_NOT_FOUND, "Unknown method: " + method)
+
+func _unload():
+	if GDRESettings.is_pack_loaded():
+		GDRESettings.unload_project()
+	loaded_paths = []
+	loaded_key = ""
+
+func _get_project_info(cached: bool) -> Dictionary:
+	return {
+		"cached": cached,
+		"paths": loaded_paths,
+		"version": GDRESettings.get_version_string(),
+		"game_name": GDRESettings.get_game_name(),
+	}
+
+func _load(params: Dictionary) -> Dictionary:
+	var paths = PackedStringArray(params.get("paths", []))
+	if paths.is_empty():
+		return _error(ERR_INVALID_PARAMETER, "'paths' is required")
+	var key: String = params.get("key", "")
+	# Only one project can be loaded at a time; keep it if it's the same one
+	if GDRESettings.is_pack_loaded() and paths == loaded_paths and key == loaded_key:
+		return _get_project_info(true)
+	_unload()
+	var err = OK
+	if not key.is_empty():
+		err = GDRESettings.set_encryption_key_string(key)
+		if err != OK:
+			return _error(err, "Failed to set encryption key")
+	err = GDRESettings.load_project(paths, bool(params.get("extract_only", false)))
+	if err != OK:
+		_unload()
+		return _error(err, "Failed to load project: " + ", ".join(paths))
+	loaded_paths = paths
+	loaded_key = key
+	return _get_project_info(false)
+
+func _list(params: Dictionary) -> Dictionary:
+	if not GDRESettings.is_pack_loaded():
+		return _error(ERR_UNCONFIGURED, "No project loaded")
+	var files: PackedStringArray = []
+	GDRESettings.for_each_file(func(file): files.append(file), PackedStringArray(params.get("filters", [])), bool(params.get("sorted", false)))
+	return {"files": files}
+
+func _extract(params: Dictionary) -> Dictionary:
+	if not GDRESettings.is_pack_loaded():
+		return _error(ERR_UNCONFIGURED, "No project loaded")
+	var output_dir: String = params.get("output_dir", "")
+	if output_dir.is_empty():
+		return _error(ERR_INVALID_PARAMETER, "'output_dir' is required")
+	var pckdump = PckDumper.new()
+	var err = pckdump.pck_dump_to_dir(output_dir, PackedStringArray(params.get("files", [])))
+	if err != OK:
+		return _error(err, "Failed to extract files")
+	return {"output_dir": output_dir}
+
+func _decompile(params: Dictionary) -> Dictionary:
+	if not GDRESettings.is_pack_loaded():
+		return _error(ERR_UNCONFIGURED, "No project loaded")
+	var files = PackedStringArray(params.get("files", []))
+	if files.is_empty():
+		return _error(ERR_INVALID_PARAMETER, "'files' is required")
+	var output_dir: String = params.get("output_dir", "")
+	var scripts = {}
+	var errors = {}
+	for file in files:
+		var script: FakeGDScript = FakeGDScript.new()
+		var err = script.load_source_code(file)
+		if err != OK:
+			var message = script.get_error_message()
+			errors[file] = message if not message.is_empty() else "Failed to decompile " + file + " (error " + str(err) + ")"
+			continue
+		if output_dir.is_empty():
+			scripts[file] = script.get_source_code()
+			continue
+		var out_file = output_dir.path_join(file.trim_prefix("res://").get_basename() + ".gd")
+		GDRECommon.ensure_dir(out_file.get_base_dir())
+		var out_f = FileAccess.open(out_file, FileAccess.WRITE)
+		if out_f == null:
+			errors[file] = "Failed to open " + out_file + " for writing"
+			continue
+		out_f.store_string(script.get_source_code())
+		out_f.close()
+		scripts[file] = out_file
+	return {"scripts": scripts, "errors": errors}
+
+func _export(params: Dictionary) -> Dictionary:
+	if not GDRESettings.is_pack_loaded():
+		return _error(ERR_UNCONFIGURED, "No project loaded")
+	var output_dir: String = params.get("output_dir", "")
+	if output_dir.is_empty():
+		return _error(ERR_INVALID_PARAMETER, "'output_dir' is required")
+	var importer: ImportExporter = ImportExporter.new()
+	var err = importer.export_imports(output_dir, PackedStringArray(params.get("files", [])))
+	var report = importer.get_report()
+	var result = {"output_dir": output_dir}
+	if report != null:
+		result["report"] = report.get_report_string()
+	importer.reset()
+	if err != OK:
+		return _error(err, "Failed to export resources")
+	return result
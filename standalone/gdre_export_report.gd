@@ -24,11 +24,17 @@ var report: ImportExporterReport = null
 
 const skippable_keys: PackedStringArray = ["rewrote_metadata", "failed_rewrite_md5"]
 const DEFAULT_ASSETS_NOTE_TEXT: String = "Certain assets have been written to the .assets directory!"
+# number of entries added to a paged section each time it's expanded further
+const REPORT_PAGE_SIZE: int = 500
+
+# header item -> number of entries loaded so far
+var paged_loaded: Dictionary = {}
 
 signal report_done()
 
 enum TotalsTreeButton {
-	DOWNLOAD_URL
+	DOWNLOAD_URL,
+	LOAD_MORE
 }
 
 func _on_totals_tree_button_clicked(item: TreeItem, _column: int, id: int, mouse_button_index: int):
@@ -37,7 +43,45 @@ func _on_totals_tree_button_clicked(item: TreeItem, _column: int, id: int, mouse
 	match id:
 		TotalsTreeButton.DOWNLOAD_URL:
 			OS.shell_open(item.get_text(_column))
+		TotalsTreeButton.LOAD_MORE:
+			var header_item = item.get_parent()
+			item.free()
+			load_next_page(header_item)
 	pass
+
+func _on_totals_tree_item_collapsed(item: TreeItem):
+	if item.collapsed or not paged_loaded.has(item) or paged_loaded[item] > 0:
+		return
+	# remove the placeholder
+	for child in item.get_children():
+		child.free()
+	load_next_page(item)
+
+func add_successes_section(parent: TreeItem, label: String):
+	var count = report.get_successes_count()
+	if count == 0:
+		return
+	var header_item = TOTALS_TREE.create_item(parent)
+	header_item.set_text(0, label)
+	header_item.set_text(1, String.num_uint64(count))
+	# placeholder so that the item can be expanded; entries are loaded on demand
+	TOTALS_TREE.create_item(header_item).set_text(0, "Loading...")
+	header_item.collapsed = true
+	paged_loaded[header_item] = 0
+
+func load_next_page(header_item: TreeItem):
+	var offset: int = paged_loaded[header_item]
+	var page = report.get_successes_page(offset, REPORT_PAGE_SIZE)
+	for entry in page:
+		var subitem = TOTALS_TREE.create_item(header_item)
+		subitem.set_text(0, entry["new_source_path"])
+		subitem.set_text(1, entry["path"])
+	paged_loaded[header_item] = offset + page.size()
+	var remaining = report.get_successes_count() - paged_loaded[header_item]
+	if remaining > 0:
+		var more_item = TOTALS_TREE.create_item(header_item)
+		more_item.set_text(0, "(%d more...)" % remaining)
+		more_item.add_button(0, file_icon, TotalsTreeButton.LOAD_MORE, false, "Load more")
 # MUST CALL set_root_window() first!!!
 # Called when the node enters the scene tree for the first time.
 func _ready():
@@ -62,6 +106,7 @@ func _ready():
 	if _is_test:
 		load_test()
 	TOTALS_TREE.connect("button_clicked", self._on_totals_tree_button_clicked)
+	TOTALS_TREE.connect("item_collapsed", self._on_totals_tree_item_collapsed)
 
 	pass # Replace with function body.
 
@@ -160,11 +205,13 @@ func add_report(rep: ImportExporterReport) -> int:
 	add_ver_string(report.get_ver())
 	add_log_file(report.get_log_file_location())
 	var notes = report.get_session_notes()
-	var report_sections: Dictionary = report.get_report_sections()
+	# the success section can be huge, so it's paged in as it's expanded instead
+	var report_sections: Dictionary = report.get_report_sections(false)
 	var report_labels: Dictionary = report.get_section_labels()
 
 	add_notes(notes)
 	add_report_sections(report_sections, report_labels)
+	add_successes_section(TOTALS_TREE.get_root(), report_labels.get("success", "success"))
 	# iterate over all the keys in the notes
 	# add fake root
 	return OK
@@ -248,6 +295,7 @@ func add_report_sections(report_sections: Dictionary, report_labels: Dictionary)
 func clear():
 	NOTE_TREE.clear()
 	TOTALS_TREE.clear()
+	paged_loaded.clear()
 	EDITOR_MESSAGE_LABEL.text = editor_message_default_text
 	LOG_FILE_LABEL.text = log_file_default_text
 	report = null
@@ -721,11 +721,18 @@ func dump_files(output_dir:String, files: PackedStringArray, ignore_checksum_err
 	# print("Extraction complete in %02dm%02ds" % [(secs_taken) / 60, (secs_taken) % 60])
 	return err;
 
-var MAIN_COMMANDS = ["--recover", "--extract", "--compile", "--list-bytecode-versions", "--pck-create", "--pck-patch", "--txt-to-bin", "--bin-to-txt"]
+var MAIN_COMMANDS = ["--recover", "--extract", "--compile", "--list-bytecode-versions", "--pck-create", "--pck-patch", "--txt-to-bin", "--bin-to-txt", "--daemon", "--batch"]
 var MAIN_CMD_NOTES = """Main commands:
 --recover=<GAME_PCK/EXE/APK/DIR>   Perform full project recovery on the specified PCK, APK, EXE, or extracted project directory.
 --extract=<GAME_PCK/EXE/APK>       Extract the specified PCK, APK, or EXE.
 --list-files=<GAME_PCK/EXE/APK>    List all files in the specified PCK, APK, or EXE and exit (can be repeated)
+--daemon                           Run as a server reading line-delimited JSON-RPC requests from stdin
+                                   (methods: load, unload, list, extract, decompile, export, ping, quit;
+                                   responses are written to stdout as lines prefixed with the 0x1E record separator)
+--batch=<MANIFEST_JSON>            Recover every pack listed in the JSON manifest in one process and print a per-pack timing summary
+                                   (entries: {"input": <PCK/DIR or [PCKs]>, "output": <DIR>, "key", "extract_only", "includes", "excludes",
+                                   "ignore_checksum_errors", "skip_checksum_check", "csharp_assembly", "test_recovery", "test_output"};
+                                   optional top-level "prefetch_mb" reads ahead up to that much of the next entry's packs)
 --compile=<GD_FILE>                Compile GDScript files to bytecode (can be repeated and use globs, requires --bytecode)
 --decompile=<GDC_FILE>             Decompile GDC files to text (can be repeated and use globs)
 --pck-create=<PCK_DIR>             Create a PCK file from the specified directory (requires --pck-version and --pck-engine-version)
@@ -790,6 +797,7 @@ var CREATE_OPTS_NOTES = """Create PCK Options:
 --pck-engine-version=<ENGINE_VERSION>    The version of the engine to create the PCK for (x.y.z)
 --embed=<EXE_TO_EMBED>                   The executable to embed the PCK into
 --key=<KEY>                              64-character hex string to encrypt the PCK with
+--pck-dedup                              Store identical files only once; duplicate entries share the same payload
 """
 
 var PATCH_OPTS_NOTES = """Patch PCK Options:
@@ -869,7 +877,9 @@ func recovery(  input_files:PackedStringArray,
 				skip_md5: bool = false,
 				csharp_assembly: String = "",
 				test_recovery: bool = false,
-				test_output_dir: String = ""):
+				test_output_dir: String = "",
+				r_stats: Dictionary = {}):
+	# r_stats receives the output dir, the time taken by each step (load_ms, extract_ms, export_ms), the file count and the engine version
 	var _new_files = []
 	for file in input_files:
 		file = get_cli_abs_path(file)
@@ -895,6 +905,7 @@ func recovery(  input_files:PackedStringArray,
 			output_dir += "_recovery"
 	else:
 		output_dir = get_cli_abs_path(output_dir)
+	r_stats["output"] = output_dir
 
 	da = DirAccess.open(input_file.get_base_dir())
 
@@ -932,7 +943,9 @@ func recovery(  input_files:PackedStringArray,
 			print("Error: failed to set key!")
 			return 1
 
+	var step_start = Time.get_ticks_msec()
 	err = GDRESettings.load_project(input_files, extract_only, csharp_assembly)
+	r_stats["load_ms"] = Time.get_ticks_msec() - step_start
 	if (err != OK):
 		print_usage()
 		print("Error: failed to open ", (GDRECommon.get_files_for_paths(input_files)))
@@ -943,6 +956,7 @@ func recovery(  input_files:PackedStringArray,
 	var ver_minor = GDRESettings.get_ver_minor()
 	var version:String = GDRESettings.get_version_string()
 	print("Version: " + version)
+	r_stats["version"] = version
 	var files: PackedStringArray = []
 	if translation_only and scripts_only:
 		print("Error: cannot specify both --translation-only and --scripts-only")
@@ -992,10 +1006,12 @@ func recovery(  input_files:PackedStringArray,
 			print(GLOB_NOTES)
 			return 1
 
+	r_stats["files"] = files.size()
 	if output_dir != input_file and not is_dir:
 		if (da.file_exists(output_dir)):
 			print("Error: output dir appears to be a file, not extracting...")
 			return 1
+	step_start = Time.get_ticks_msec()
 	if is_dir:
 		if extract_only:
 			print("Why did you open a folder to extract it??? What's wrong with you?!!?")
@@ -1008,6 +1024,7 @@ func recovery(  input_files:PackedStringArray,
 		if (err != OK):
 			print("Error: failed to extract PAK file, not exporting assets")
 			return 1
+	r_stats["extract_ms"] = Time.get_ticks_msec() - step_start
 	var end_time;
 	var secs_taken;
 	if (extract_only):
@@ -1015,8 +1032,10 @@ func recovery(  input_files:PackedStringArray,
 		secs_taken = (end_time - start_time) / 1000
 		print("Extraction operation complete in %02dm%02ds" % [(secs_taken) / 60, (secs_taken) % 60])
 		return 0
+	step_start = Time.get_ticks_msec()
 	var importer:ImportExporter = ImportExporter.new()
 	err = importer.export_imports(output_dir, files)
+	r_stats["export_ms"] = Time.get_ticks_msec() - step_start
 
 	if err != OK and err != ERR_SKIP:
 		print("Error: failed to export imports: " + GDRESettings.get_recent_error_string())
@@ -1036,7 +1055,8 @@ func recovery(  input_files:PackedStringArray,
 		return 0
 	return 0
 
-func load_pck(input_files: PackedStringArray, extract_only: bool, includes, excludes, enc_key: String = ""):
+# Returns the parent dir of the loaded project, or an empty string on failure
+func open_project(input_files: PackedStringArray, extract_only: bool, enc_key: String = "") -> String:
 	var _new_files = []
 	for file in input_files:
 		file = get_cli_abs_path(file)
@@ -1046,7 +1066,7 @@ func load_pck(input_files: PackedStringArray, extract_only: bool, includes, excl
 		else:
 			print_usage()
 			print("Error: failed to locate " + file)
-			return []
+			return ""
 	print("Input files: ", str(_new_files))
 	input_files = _new_files
 	var input_file = input_files[0]
@@ -1062,19 +1082,19 @@ func load_pck(input_files: PackedStringArray, extract_only: bool, includes, excl
 	if da == null:
 		print_usage()
 		print("Error: failed to locate parent dir for " + input_file)
-		return []
+		return ""
 	#directory
 	if da.dir_exists(input_file):
 		if input_files.size() > 1:
 			print_usage()
 			print("Error: cannot specify multiple directories")
-			return []
+			return ""
 		if input_file.get_extension().to_lower() == "app":
 			is_dir = false
 		elif !da.dir_exists(input_file.path_join(".import")) && !da.dir_exists(input_file.path_join(".godot")):
 			print_usage()
 			print("Error: " + input_file + " does not appear to be a project directory")
-			return []
+			return ""
 		else:
 			parent_dir = input_file
 			is_dir = true
@@ -1082,19 +1102,25 @@ func load_pck(input_files: PackedStringArray, extract_only: bool, includes, excl
 	elif not da.file_exists(input_file):
 		print_usage()
 		print("Error: failed to locate " + input_file)
-		return []
+		return ""
 
 	if (enc_key != ""):
 		err = GDRESettings.set_encryption_key_string(enc_key)
 		if (err != OK):
 			print_usage()
 			print("Error: failed to set key!")
-			return []
+			return ""
 
 	err = GDRESettings.load_project(input_files, extract_only)
 	if (err != OK):
 		print_usage()
 		print("Error: failed to open ", (GDRECommon.get_files_for_paths(input_files)))
+		return ""
+	return parent_dir
+
+func load_pck(input_files: PackedStringArray, extract_only: bool, includes, excludes, enc_key: String = ""):
+	var parent_dir = open_project(input_files, extract_only, enc_key)
+	if parent_dir.is_empty():
 		return []
 
 	var files: PackedStringArray = []
@@ -1293,7 +1319,7 @@ func bin_to_text(files: PackedStringArray, output_dir: String):
 
 
 
-func create_pck(pck_file: String, pck_dir: String, pck_version: int, pck_engine_version: String, includes: PackedStringArray = [], excludes: PackedStringArray = [], enc_key: String = "", embed_pck: String = "", watermark: String = ""):
+func create_pck(pck_file: String, pck_dir: String, pck_version: int, pck_engine_version: String, includes: PackedStringArray = [], excludes: PackedStringArray = [], enc_key: String = "", embed_pck: String = "", watermark: String = "", dedup: bool = false):
 	if (pck_version < 0 or pck_engine_version == ""):
 		print_usage()
 		print("Error: --pck-version and --pck-engine-version are required for --pck-create")
@@ -1334,6 +1360,7 @@ func create_pck(pck_file: String, pck_dir: String, pck_version: int, pck_engine_
 		print("Embedding PCK: " + embed_pck)
 	if (not watermark.is_empty()):
 		pck.watermark = watermark
+	pck.dedup = dedup
 	var err = pck.pck_create(pck_file, pck_dir, includes, excludes)
 	if err != OK:
 		print("Error: failed to create PCK file: " + err)
@@ -1427,12 +1454,13 @@ func patch_translations(pck_files: PackedStringArray, patch_translations: Dictio
 	return 0
 
 func list_files(pck_files: PackedStringArray):
-	var files = load_pck(pck_files, true, [], [], "")
+	if open_project(pck_files, true).is_empty():
+		return -1
 	print("\nContents:")
-	for file in files:
-		print(file)
+	# Stream the entries instead of building the whole list first
+	var total = GDRESettings.for_each_file(func(file): print(file))
 
-	print("\nTotal files: " + str(files.size()))
+	print("\nTotal files: " + str(total))
 
 	return 0
 
@@ -1457,6 +1485,7 @@ func handle_cli(args: PackedStringArray) -> bool:
 	var pck_version: int             = -1
 	var pck_engine_version: String   = ""
 	var embed_pck: String             = ""
+	var pck_dedup: bool = false
 	var output_dir: String = ""
 	var enc_key: String = ""
 	var txt_to_bin = PackedStringArray()
@@ -1476,6 +1505,7 @@ func handle_cli(args: PackedStringArray) -> bool:
 	var locales_to_patch: PackedStringArray = []
 	var test_recovery: bool = false
 	var test_output_dir: String = ""
+	var batch_manifest: String = ""
 	if (args.size() == 0):
 		return false
 	var any_commands = false
@@ -1554,6 +1584,11 @@ func handle_cli(args: PackedStringArray) -> bool:
 		elif arg.begins_with("--list-files"):
 			input_file.append(get_arg_value(arg).simplify_path())
 			main_cmds["list-files"] = true
+		elif arg.begins_with("--daemon"):
+			main_cmds["daemon"] = true
+		elif arg.begins_with("--batch"):
+			batch_manifest = get_cli_abs_path(get_arg_value(arg))
+			main_cmds["batch"] = true
 		elif arg.begins_with("--list-bytecode-versions"):
 			print_bytecode_versions()
 			return true
@@ -1582,6 +1617,8 @@ func handle_cli(args: PackedStringArray) -> bool:
 			pck_engine_version = (get_arg_value(arg))
 		elif arg.begins_with("--embed"):
 			embed_pck = get_cli_abs_path(get_arg_value(arg))
+		elif arg == "--pck-dedup":
+			pck_dedup = true
 		elif arg.begins_with("--print-plugin-cache"):
 			print_plugin_cache()
 			return true
@@ -1681,6 +1718,10 @@ func handle_cli(args: PackedStringArray) -> bool:
 			print("Prepop complete in %02dm%02ds" % [(secs_taken) / 60, (secs_taken) % 60])
 		elif main_cmds.has("list-files"):
 			ret_code = list_files(input_file)
+		elif main_cmds.has("daemon"):
+			ret_code = GDREDaemon.new().run()
+		elif main_cmds.has("batch"):
+			ret_code = GDREBatch.new(self).run(batch_manifest)
 		elif compile_files.size() > 0:
 			ret_code = compile(compile_files, bytecode_version, output_dir)
 		elif decompile_files.size() > 0:
@@ -1720,7 +1761,7 @@ func handle_cli(args: PackedStringArray) -> bool:
 		elif bin_to_txt.is_empty() == false:
 			ret_code = bin_to_text(bin_to_txt, output_dir)
 		elif not pck_create_dir.is_empty():
-			ret_code = create_pck(output_dir, pck_create_dir, pck_version, pck_engine_version, includes, excludes, enc_key, embed_pck)
+			ret_code = create_pck(output_dir, pck_create_dir, pck_version, pck_engine_version, includes, excludes, enc_key, embed_pck, "", pck_dedup)
 		else:
 			print_usage()
 			print("ERROR: invalid option! Must specify one of " + ", ".join(MAIN_COMMANDS))
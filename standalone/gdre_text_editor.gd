@@ -116,6 +116,9 @@ var code_opts_panel_button_icon = preload("res://gdre_icons/gdre_GuiTabMenuHl.sv
 
 var find_replace_bar: GDREFindReplaceBar = null
 
+# id of the GDREPreviewService request whose result should be shown; stale results are ignored
+var pending_preview_id: int = -1
+
 func _init():
 	CODE_VIEWER = self
 
@@ -199,8 +202,21 @@ func _init():
 
 func _ready():
 	set_highlight_type(default_highlighter)
+	GDREPreviewService.preview_ready.connect(self._on_preview_ready)
+
+func _on_preview_ready(id: int, _path: String, _kind: int, result, error: String):
+	if id != pending_preview_id:
+		return
+	pending_preview_id = -1
+	if not error.is_empty():
+		set_text_viewer_props()
+		set_viewer_text("Error loading script:\n" + error)
+	else:
+		set_code_viewer_props()
+		set_viewer_text(result)
 
 func reset():
+	pending_preview_id = -1
 	current_path = ""
 	set_viewer_text("")
 	set_text_viewer_props()
@@ -253,6 +269,7 @@ func set_viewer_text(text: String):
 
 func load_code(path, override_bytecode_revision: int = 0) -> bool:
 	var code_text = ""
+	pending_preview_id = -1
 	current_path = path
 	var ext = path.get_extension().to_lower()
 	if ext == "cs":
@@ -269,16 +286,10 @@ func load_code(path, override_bytecode_revision: int = 0) -> bool:
 		else:
 			set_csharp_viewer_props()
 	elif ext == "gde" or ext == "gdc":
-		var script: FakeGDScript = FakeGDScript.new()
-		if (override_bytecode_revision != 0):
-			script.set_override_bytecode_revision(override_bytecode_revision)
-		script.load_source_code(path)
-		if not script.get_error_message().is_empty():
-			code_text = "Error loading script:\n" + script.get_error_message()
-			set_text_viewer_props()
-		else:
-			code_text = script.get_source_code()
-			set_code_viewer_props()
+		# decompiled in the background; _on_preview_ready fills in the text unless another file gets selected first
+		code_text = "Decompiling..."
+		set_text_viewer_props()
+		pending_preview_id = GDREPreviewService.request_source(path, override_bytecode_revision)
 	else: # ext == "gd"
 		code_text = FileAccess.get_file_as_string(path)
 		set_code_viewer_props()
@@ -287,12 +298,14 @@ func load_code(path, override_bytecode_revision: int = 0) -> bool:
 	return true
 
 func load_text_resource(path):
+	pending_preview_id = -1
 	current_path = path
 	set_resource_viewer_props()
 	set_viewer_text(ResourceCompatLoader.resource_to_string(path))
 	return true
 
 func load_text_string(text):
+	pending_preview_id = -1
 	current_path = ""
 	set_text_viewer_props()
 	set_viewer_text(text)
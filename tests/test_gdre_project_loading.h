@@ -6,6 +6,9 @@
 #include "test_common.h"
 #include "tests/test_macros.h"
 
+#include <core/crypto/crypto_core.h>
+#include <core/io/delta_encoding.h>
+#include <core/io/file_access_pack.h>
 #include <core/io/pck_packer.h>
 #include <core/io/resource_format_binary.h>
 #include <modules/gdscript/gdscript_tokenizer_buffer.h>
@@ -13,7 +16,10 @@
 
 #include "core/version_generated.gen.h"
 #include <utility/file_access_gdre.h>
+#include <utility/file_access_mapped.h>
+#include <utility/gdre_config.h>
 #include <utility/import_exporter.h>
+#include <utility/pck_creator.h>
 #include <utility/pck_dumper.h>
 
 inline Error create_test_pck(const String &pck_path, const HashMap<String, String> &paths) {
@@ -170,6 +176,129 @@ TEST_CASE("[GDSDecomp] FileAccessGDRE tests") {
 	gdre::rimraf(tmp_pck_path);
 }
 
+// Writes a format v2 patch pack containing a single delta-encoded file.
+inline Error create_delta_patch_pck(const String &pck_path, const String &res_path, const Vector<uint8_t> &delta) {
+	Ref<FileAccess> fa = FileAccess::open(pck_path, FileAccess::WRITE);
+	ERR_FAIL_COND_V(fa.is_null(), ERR_FILE_CANT_OPEN);
+	CharString path_utf8 = res_path.utf8();
+	uint64_t header_size = 4 * 5 + 4 + 8 + 4 * 16 + 4;
+	uint64_t file_base = header_size + 4 + path_utf8.length() + 8 + 8 + 16 + 4;
+	fa->store_32(PACK_HEADER_MAGIC);
+	fa->store_32(PACK_FORMAT_VERSION_V2);
+	fa->store_32(GODOT_VERSION_MAJOR);
+	fa->store_32(GODOT_VERSION_MINOR);
+	fa->store_32(GODOT_VERSION_PATCH);
+	fa->store_32(0); // pack flags
+	fa->store_64(file_base);
+	for (int i = 0; i < 16; i++) {
+		fa->store_32(0);
+	}
+	fa->store_32(1);
+	fa->store_32(path_utf8.length());
+	fa->store_buffer((const uint8_t *)path_utf8.get_data(), path_utf8.length());
+	fa->store_64(0);
+	fa->store_64(delta.size());
+	CryptoCore::MD5Context ctx;
+	unsigned char md5[16];
+	ctx.start();
+	ctx.update(delta.ptr(), delta.size());
+	ctx.finish(md5);
+	fa->store_buffer(md5, 16);
+	fa->store_32(PACK_FILE_DELTA);
+	ERR_FAIL_COND_V(fa->get_position() != file_base, ERR_BUG);
+	fa->store_buffer(delta);
+	return OK;
+}
+
+TEST_CASE("[GDSDecomp] Delta-patched packs") {
+	REQUIRE(gdre::ensure_dir(get_tmp_path()) == OK);
+	auto base_pck_path = get_tmp_path().path_join("delta_base.pck");
+	auto patch_pck_path = get_tmp_path().path_join("delta_patch.pck");
+	auto tmp_test_file = get_tmp_path().path_join("delta.txt");
+
+	// large enough that the file would also be memory-mapped on its own
+	String old_text;
+	for (int i = 0; i < 8192; i++) {
+		old_text += vformat("line %d\n", i);
+	}
+	String new_text = old_text.replace("line 4096", "patched line 4096");
+	Vector<uint8_t> old_data = old_text.to_utf8_buffer();
+	Vector<uint8_t> new_data = new_text.to_utf8_buffer();
+	Vector<uint8_t> delta;
+	REQUIRE(DeltaEncoding::encode_delta(old_data, new_data, delta) == OK);
+
+	CHECK(store_file_as_string(tmp_test_file, old_text) == OK);
+	CHECK(create_test_pck(base_pck_path, { { "res://delta.txt", tmp_test_file } }) == OK);
+	CHECK(create_delta_patch_pck(patch_pck_path, "res://delta.txt", delta) == OK);
+
+	auto settings = GDRESettings::get_singleton();
+	REQUIRE(settings);
+	bool was_mapping_enabled = GDREConfig::get_singleton()->get_setting("memory_map_packs", true);
+	for (bool mapped : { true, false }) {
+		SUBCASE(mapped ? "Memory-mapped" : "Not memory-mapped") {
+			GDREConfig::get_singleton()->set_setting("memory_map_packs", mapped, true);
+			REQUIRE(settings->load_project({ base_pck_path, patch_pck_path }, false) == OK);
+			CHECK(FileAccessMapped::is_enabled() == mapped);
+			Ref<FileAccess> fa = FileAccess::open("res://delta.txt", FileAccess::READ);
+			REQUIRE(fa.is_valid());
+			CHECK(fa->get_buffer(fa->get_length()) == new_data);
+			fa.unref();
+			CHECK(settings->unload_project() == OK);
+		}
+	}
+	GDREConfig::get_singleton()->set_setting("memory_map_packs", was_mapping_enabled, true);
+
+	gdre::rimraf(tmp_test_file);
+	gdre::rimraf(base_pck_path);
+	gdre::rimraf(patch_pck_path);
+}
+
+TEST_CASE("[GDSDecomp] PckCreator deduplication") {
+	String src_dir = get_tmp_path().path_join("dedup_src");
+	String dedup_pck_path = get_tmp_path().path_join("dedup.pck");
+	String plain_pck_path = get_tmp_path().path_join("no_dedup.pck");
+	String shared_content = String("shared payload ").repeat(7);
+	HashMap<String, String> files = {
+		{ "res://a.txt", shared_content },
+		{ "res://b.txt", shared_content },
+		{ "res://sub/c.txt", shared_content },
+		// same size as the shared content, different bytes
+		{ "res://d.txt", String("unique payload ").repeat(7) },
+		{ "res://e.txt", "something else" },
+	};
+	for (const auto &E : files) {
+		REQUIRE(store_file_as_string(src_dir.path_join(E.key.trim_prefix("res://")), E.value) == OK);
+	}
+
+	auto create_pck = [&](const String &p_pck_path, bool p_dedup) {
+		Ref<PckCreator> creator;
+		creator.instantiate();
+		creator->set_dedup(p_dedup);
+		REQUIRE(creator->pck_create(p_pck_path, src_dir, {}, {}) == OK);
+		return creator;
+	};
+	Ref<PckCreator> dedup_creator = create_pck(dedup_pck_path, true);
+	Ref<PckCreator> plain_creator = create_pck(plain_pck_path, false);
+	CHECK(dedup_creator->get_dedup_count() == 2);
+	CHECK(plain_creator->get_dedup_count() == 0);
+	CHECK(dedup_creator->get_dedup_bytes_saved() > 0);
+	CHECK(FileAccess::get_size(plain_pck_path) - FileAccess::get_size(dedup_pck_path) == (int64_t)dedup_creator->get_dedup_bytes_saved());
+
+	auto settings = GDRESettings::get_singleton();
+	REQUIRE(settings);
+	REQUIRE(settings->load_project({ dedup_pck_path }, false) == OK);
+	CHECK(settings->get_file_list().size() == files.size());
+	for (const auto &E : files) {
+		CHECK(settings->has_path_loaded(E.key));
+		CHECK(FileAccess::get_file_as_string(E.key) == E.value);
+	}
+	CHECK(settings->unload_project() == OK);
+
+	gdre::rimraf(src_dir);
+	gdre::rimraf(dedup_pck_path);
+	gdre::rimraf(plain_pck_path);
+}
+
 // Disabling this for now; fragile and kind of redundant.
 #if 0
 static constexpr const char *const export_presets =
@@ -0,0 +1,109 @@
+#pragma once
+#include "tests/test_macros.h"
+
+#include "bytecode/bytecode_base.h"
+#include "core/io/dir_access.h"
+#include "core/io/image.h"
+#include "gui/gdre_preview_service.h"
+#include "test_common.h"
+
+TEST_CASE("[GDSDecomp][PreviewService] Thumbnails, caching and cancellation") {
+	GDREPreviewService *service = GDREPreviewService::get_singleton();
+	REQUIRE(service != nullptr);
+	service->clear_cache();
+	service->set_cache_max_size(1024 * 1024);
+
+	String dir = get_tmp_path().path_join("preview_service");
+	DirAccess::make_dir_recursive_absolute(dir);
+	String image_path = dir.path_join("image.png");
+	Ref<Image> image = Image::create_empty(512, 256, false, Image::FORMAT_RGBA8);
+	image->fill(Color(1, 0, 0, 1));
+	REQUIRE(image->save_png(image_path) == OK);
+
+	int64_t id = service->request_thumbnail(image_path, 64);
+	Dictionary result = service->wait_for_request(id);
+	REQUIRE(int(result["status"]) == GDREPreviewService::STATUS_DONE);
+	Ref<Image> thumb = result["result"];
+	REQUIRE(thumb.is_valid());
+	// aspect ratio is kept
+	CHECK(thumb->get_width() == 64);
+	CHECK(thumb->get_height() == 32);
+
+	// second request is served from the cache without going through the queue
+	int64_t cached_id = service->request_thumbnail(image_path, 64);
+	CHECK(service->get_request_status(cached_id) == GDREPreviewService::STATUS_DONE);
+	CHECK(int64_t(service->get_cache_stats()["hits"]) == 1);
+
+	// a newer selection cancels the unfinished one; pausing keeps the stale request from starting before that
+	service->set_paused(true);
+	int64_t stale_id = service->request_thumbnail(image_path, 32);
+	int64_t latest_id = service->request_thumbnail(image_path, 16);
+	CHECK(service->get_request_status(stale_id) == GDREPreviewService::STATUS_CANCELLED);
+	CHECK(service->get_request_status(latest_id) == GDREPreviewService::STATUS_PENDING);
+	service->set_paused(false);
+	result = service->wait_for_request(latest_id);
+	CHECK(int(result["status"]) == GDREPreviewService::STATUS_DONE);
+
+	// results of requests made before the cache was cleared are delivered, but not cached
+	service->set_paused(true);
+	int64_t old_generation_id = service->request_thumbnail(image_path, 8);
+	service->clear_cache();
+	service->set_paused(false);
+	result = service->wait_for_request(old_generation_id);
+	CHECK(int(result["status"]) == GDREPreviewService::STATUS_DONE);
+	CHECK(Ref<Image>(result["result"]).is_valid());
+	CHECK(int64_t(service->get_cache_stats()["entries"]) == 0);
+
+	// errors are reported, not cached
+	int64_t missing_id = service->request_thumbnail(dir.path_join("missing.png"), 64);
+	result = service->wait_for_request(missing_id);
+	CHECK(int(result["status"]) == GDREPreviewService::STATUS_DONE);
+	CHECK(!String(result["error"]).is_empty());
+
+	service->clear_cache();
+	CHECK(int64_t(service->get_cache_stats()["entries"]) == 0);
+	service->set_cache_max_size(-1);
+}
+
+TEST_CASE("[GDSDecomp][PreviewService] Script sources") {
+	GDREPreviewService *service = GDREPreviewService::get_singleton();
+	REQUIRE(service != nullptr);
+	service->clear_cache();
+	service->set_cache_max_size(1024 * 1024);
+
+	String script_path = get_test_scripts_path().path_join("4.4").path_join("code").path_join("mob.gdc");
+	REQUIRE(FileAccess::exists(script_path));
+	Ref<GDScriptDecomp> decomp = GDScriptDecomp::create_decomp_for_version("4.4");
+	REQUIRE(decomp.is_valid());
+	int revision = decomp->get_bytecode_rev();
+	REQUIRE(decomp->decompile_buffer(FileAccess::get_file_as_bytes(script_path)) == OK);
+	String expected_source = decomp->get_script_text();
+	REQUIRE(!expected_source.is_empty());
+
+	int64_t id = service->request_source(script_path, revision);
+	Dictionary result = service->wait_for_request(id);
+	REQUIRE(int(result["status"]) == GDREPreviewService::STATUS_DONE);
+	CHECK(int(result["kind"]) == GDREPreviewService::PREVIEW_SOURCE);
+	CHECK(String(result["error"]).is_empty());
+	CHECK(String(result["result"]) == expected_source);
+
+	// cached per bytecode revision
+	int64_t cached_id = service->request_source(script_path, revision);
+	CHECK(service->get_request_status(cached_id) == GDREPreviewService::STATUS_DONE);
+	CHECK(int64_t(service->get_cache_stats()["hits"]) == 1);
+
+	// bytecode that doesn't match the revision is an error, not an empty source
+	String bad_path = get_tmp_path().path_join("preview_service").path_join("bad.gdc");
+	gdre::ensure_dir(bad_path.get_base_dir());
+	Ref<FileAccess> f = FileAccess::open(bad_path, FileAccess::WRITE);
+	REQUIRE(f.is_valid());
+	f->store_string("GDSC not really bytecode");
+	f.unref();
+	int64_t bad_id = service->request_source(bad_path, revision);
+	result = service->wait_for_request(bad_id);
+	CHECK(int(result["status"]) == GDREPreviewService::STATUS_DONE);
+	CHECK(!String(result["error"]).is_empty());
+
+	service->clear_cache();
+	service->set_cache_max_size(-1);
+}
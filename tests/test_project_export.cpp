@@ -82,6 +82,14 @@ Error test_export_project(const String &version, const String &sub_project, cons
 		Ref<ImportExporterReport> import_exporter_report2 = ImportExporterReport::from_json(json_report);
 		CHECK(import_report->is_equal_to(import_exporter_report2));
 	}
+	{
+		// the streamed json should parse to the same report
+		String json_path = exported_recovery_dir.path_join("streamed_report.json");
+		REQUIRE_EQ(import_report->save_json(json_path), OK);
+		Ref<ImportExporterReport> streamed_report = ImportExporterReport::from_json(JSON::parse_string(FileAccess::get_file_as_string(json_path)));
+		CHECK(import_report->is_equal_to(streamed_report));
+		gdre::rimraf(json_path);
+	}
 #ifdef DEBUG_ENABLED
 	{
 		String json_report_path = exported_recovery_dir.path_join("json_report.json");
@@ -0,0 +1,53 @@
+#pragma once
+#include "tests/test_macros.h"
+
+#include "compat/resource_cache_compat.h"
+
+TEST_CASE("[GDSDecomp][ResourceCacheCompat] LRU eviction and bypass") {
+	ResourceCacheCompat::clear();
+	ResourceCacheCompat::reset_stats();
+	ResourceCacheCompat::set_max_size(300);
+	uint64_t generation = ResourceCacheCompat::get_generation();
+
+	Ref<Resource> a = memnew(Resource);
+	Ref<Resource> b = memnew(Resource);
+	Ref<Resource> c = memnew(Resource);
+	ResourceCacheCompat::put("res://a.res", ResourceInfo::NON_GLOBAL_LOAD, a, 100, generation);
+	ResourceCacheCompat::put("res://b.res", ResourceInfo::NON_GLOBAL_LOAD, b, 100, generation);
+	CHECK(ResourceCacheCompat::get("res://a.res", ResourceInfo::NON_GLOBAL_LOAD) == a);
+	// different load type is a different entry
+	CHECK(ResourceCacheCompat::get("res://a.res", ResourceInfo::FAKE_LOAD).is_null());
+
+	// "a" was used more recently, so "b" gets evicted
+	ResourceCacheCompat::put("res://c.res", ResourceInfo::NON_GLOBAL_LOAD, c, 150, generation);
+	CHECK(ResourceCacheCompat::get("res://b.res", ResourceInfo::NON_GLOBAL_LOAD).is_null());
+	CHECK(ResourceCacheCompat::get("res://a.res", ResourceInfo::NON_GLOBAL_LOAD) == a);
+	CHECK(ResourceCacheCompat::get("res://c.res", ResourceInfo::NON_GLOBAL_LOAD) == c);
+	CHECK(ResourceCacheCompat::get_total_size() == 250);
+
+	{
+		ResourceCacheCompat::Bypass bypass;
+		CHECK(ResourceCacheCompat::get("res://a.res", ResourceInfo::NON_GLOBAL_LOAD).is_null());
+	}
+
+	Dictionary stats = ResourceCacheCompat::get_stats();
+	CHECK(int64_t(stats["hits"]) == 3);
+	CHECK(int64_t(stats["misses"]) == 2);
+	CHECK(int64_t(stats["evictions"]) == 1);
+
+	ResourceCacheCompat::clear();
+	CHECK(ResourceCacheCompat::get("res://a.res", ResourceInfo::NON_GLOBAL_LOAD).is_null());
+
+	// a load that started before clear() must not be cached afterwards
+	ResourceCacheCompat::put("res://b.res", ResourceInfo::NON_GLOBAL_LOAD, b, 100, generation);
+	CHECK(ResourceCacheCompat::get("res://b.res", ResourceInfo::NON_GLOBAL_LOAD).is_null());
+	CHECK(ResourceCacheCompat::get_total_size() == 0);
+	uint64_t new_generation = 0;
+	CHECK(ResourceCacheCompat::get("res://b.res", ResourceInfo::NON_GLOBAL_LOAD, &new_generation).is_null());
+	CHECK(new_generation != generation);
+	ResourceCacheCompat::put("res://b.res", ResourceInfo::NON_GLOBAL_LOAD, b, 100, new_generation);
+	CHECK(ResourceCacheCompat::get("res://b.res", ResourceInfo::NON_GLOBAL_LOAD) == b);
+
+	ResourceCacheCompat::clear();
+	ResourceCacheCompat::set_max_size(0);
+}
@@ -3,6 +3,10 @@
 #include "test_common.h"
 #include "tests/test_macros.h"
 
+#include "core/math/random_pcg.h"
+#include "exporters/sample_exporter.h"
+#include "scene/resources/audio_stream_wav.h"
+
 namespace TestResourceExport {
 
 Error test_export_sample(const String &version);
@@ -42,4 +46,88 @@ TEST_CASE("[GDSDecomp][ResourceExport] Export texture") {
 	}
 }
 
+TEST_CASE("[GDSDecomp][ResourceExport] Decompress IMA ADPCM") {
+	const uint8_t input[16] = { 0x77, 0x77, 0x7F, 0x70, 0x07, 0x34, 0x1A, 0xC9, 0x88, 0xF0, 0x5E, 0x62, 0x77, 0x77, 0x25, 0xB3 };
+	Vector<uint8_t> data;
+	data.resize(sizeof(input));
+	memcpy(data.ptrw(), input, sizeof(input));
+
+	auto decode = [&](bool p_stereo) {
+		Ref<AudioStreamWAV> sample = memnew(AudioStreamWAV);
+		sample->set_format(AudioStreamWAV::FORMAT_IMA_ADPCM);
+		sample->set_mix_rate(22050);
+		sample->set_stereo(p_stereo);
+		sample->set_data(data);
+		Ref<AudioStreamWAV> decoded = SampleExporter::convert_adpcm_to_16bit(sample);
+		REQUIRE(decoded.is_valid());
+		CHECK(decoded->get_format() == AudioStreamWAV::FORMAT_16_BITS);
+		return decoded->get_data();
+	};
+
+	// expected output of the original per-nibble decoder
+	SUBCASE("Mono") {
+		const int16_t expected[32] = {
+			11, 41, 104, 240, -53, 578, 668, 1901, 4545, 4923, 8015, 10924, 9034, 10064, 9128, 6572,
+			6229, 5917, 6201, 2328, -4867, 5919, 13097, 30065, -784, -4884, -8984, -13084, -32768, -12290, 13779, -9920
+		};
+		Vector<uint8_t> decoded = decode(false);
+		REQUIRE(decoded.size() == (int64_t)sizeof(expected));
+		CHECK(memcmp(decoded.ptr(), expected, sizeof(expected)) == 0);
+	}
+	SUBCASE("Stereo") {
+		const int16_t expected[32] = {
+			11, 11, 41, 41, -22, 45, 114, 101, 407, 175, 449, 245, 258, 218, 361, 144,
+			330, 154, 302, 18, -37, 115, 472, 346, 1492, 819, 3677, 1839, 7112, 2858, 9399, 1931
+		};
+		Vector<uint8_t> decoded = decode(true);
+		REQUIRE(decoded.size() == (int64_t)sizeof(expected));
+		CHECK(memcmp(decoded.ptr(), expected, sizeof(expected)) == 0);
+	}
+}
+
+TEST_CASE("[GDSDecomp][ResourceExport] Decompress QOA") {
+	// long enough to be decoded frame-parallel
+	constexpr int MIX_RATE = 44100;
+	constexpr int64_t SAMPLES_PER_CHANNEL = MIX_RATE * 7;
+	RandomPCG rng(12345);
+	Vector<int16_t> pcm;
+	pcm.resize(SAMPLES_PER_CHANNEL * 2);
+	for (int64_t i = 0; i < SAMPLES_PER_CHANNEL; i++) {
+		double t = (double)i / MIX_RATE;
+		pcm.write[i * 2] = (int16_t)(Math::sin(t * Math::TAU * 440.0) * 12000 + (int)(rng.rand() % 512) - 256);
+		pcm.write[i * 2 + 1] = (int16_t)(Math::sin(t * Math::TAU * 660.0) * 12000 + (int)(rng.rand() % 512) - 256);
+	}
+	qoa_desc desc = {};
+	desc.channels = 2;
+	desc.samplerate = MIX_RATE;
+	desc.samples = SAMPLES_PER_CHANNEL;
+	unsigned int encoded_len = 0;
+	void *encoded = qoa_encode(pcm.ptr(), &desc, &encoded_len);
+	REQUIRE(encoded != nullptr);
+	Vector<uint8_t> data;
+	data.resize(encoded_len);
+	memcpy(data.ptrw(), encoded, encoded_len);
+	::free(encoded);
+
+	Ref<AudioStreamWAV> sample = memnew(AudioStreamWAV);
+	sample->set_format(AudioStreamWAV::FORMAT_QOA);
+	sample->set_mix_rate(MIX_RATE);
+	sample->set_stereo(true);
+	sample->set_data(data);
+	Ref<AudioStreamWAV> decoded = SampleExporter::convert_qoa_to_16bit(sample);
+	REQUIRE(decoded.is_valid());
+	Vector<uint8_t> decoded_data = decoded->get_data();
+
+	// must match the reference sequential decoder exactly
+	qoa_desc ref_desc = {};
+	short *expected = qoa_decode(data.ptr(), data.size(), &ref_desc);
+	REQUIRE(expected != nullptr);
+	CHECK(ref_desc.samples == SAMPLES_PER_CHANNEL);
+	CHECK(decoded_data.size() == (int64_t)ref_desc.samples * ref_desc.channels * (int64_t)sizeof(int16_t));
+	if (decoded_data.size() == (int64_t)ref_desc.samples * ref_desc.channels * (int64_t)sizeof(int16_t)) {
+		CHECK(memcmp(decoded_data.ptr(), expected, decoded_data.size()) == 0);
+	}
+	::free(expected);
+}
+
 } // namespace TestResourceExport
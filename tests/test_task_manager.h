@@ -0,0 +1,140 @@
+#pragma once
+#include "tests/test_macros.h"
+
+#include "utility/task_manager.h"
+
+#include <vector>
+
+struct GroupDispatchTestTask {
+	// processing this index cancels the task; -1 never cancels
+	int cancel_at = -1;
+	std::atomic<int> processed = 0;
+
+	void do_task(uint32_t i, std::atomic<int> *counts) {
+		counts[i]++;
+		processed++;
+		if ((int)i == cancel_at) {
+			TaskManager::get_singleton()->cancel_all();
+		}
+		// keep the items cheap but not free, so that chunks get a chance to grow
+		OS::get_singleton()->delay_usec(10);
+	}
+
+	String get_description(uint32_t i, std::atomic<int> *counts) {
+		return itos(i);
+	}
+};
+
+TEST_CASE("[GDSDecomp][TaskManager] Group task dispatch") {
+	constexpr int ELEMENTS = 10000;
+	int threads = MAX(2, TaskManager::get_max_thread_count() - 1);
+
+	for (bool chunked : { false, true }) {
+		SUBCASE(chunked ? "Chunked" : "Per-item") {
+			std::vector<std::atomic<int>> counts(ELEMENTS);
+			GroupDispatchTestTask task;
+			SUBCASE("Every element runs exactly once") {
+				Error err = TaskManager::get_singleton()->run_multithreaded_group_task(
+						&task,
+						&GroupDispatchTestTask::do_task,
+						counts.data(),
+						ELEMENTS,
+						&GroupDispatchTestTask::get_description,
+						"GroupDispatchTestTask",
+						"Testing dispatch...",
+						true, threads, true, nullptr, 0, false, chunked);
+				CHECK(err == OK);
+				CHECK(task.processed.load() == ELEMENTS);
+				int wrong_count = 0;
+				for (int i = 0; i < ELEMENTS; i++) {
+					wrong_count += counts[i] != 1 ? 1 : 0;
+				}
+				CHECK(wrong_count == 0);
+			}
+			SUBCASE("Cancellation stops dispatch") {
+				task.cancel_at = 0;
+				Error err = TaskManager::get_singleton()->run_multithreaded_group_task(
+						&task,
+						&GroupDispatchTestTask::do_task,
+						counts.data(),
+						ELEMENTS,
+						&GroupDispatchTestTask::get_description,
+						"GroupDispatchTestTask",
+						"Testing dispatch...",
+						true, threads, true, nullptr, 0, false, chunked);
+				CHECK(err == ERR_SKIP);
+				CHECK(counts[0].load() == 1);
+				// elements already claimed by other workers may finish, but the rest must not be dispatched
+				CHECK(task.processed.load() < ELEMENTS / 2);
+				int repeated = 0;
+				for (int i = 0; i < ELEMENTS; i++) {
+					repeated += counts[i] > 1 ? 1 : 0;
+				}
+				CHECK(repeated == 0);
+			}
+		}
+	}
+}
+
+struct MD5ProgressBenchmarkTask {
+	Vector<String> paths;
+	std::atomic<int> descriptions = 0;
+
+	void do_task(uint32_t i, String *md5s) {
+		md5s[i] = paths[i].md5_text();
+	}
+
+	String get_description(uint32_t i, String *md5s) {
+		descriptions++;
+		return "Hashing " + paths[i] + "...";
+	}
+};
+
+TEST_CASE("[GDSDecomp][TaskManager] Progress refreshes are rate-limited") {
+	Ref<EditorProgressGDDC> pr = memnew(EditorProgressGDDC(nullptr, "refresh_rate_test", "Testing...", 10));
+	CHECK(pr->is_refresh_due(true));
+	CHECK_FALSE(pr->is_refresh_due());
+	CHECK(pr->is_refresh_due(true));
+	pr.unref();
+}
+
+// Not part of the default run; run with `--test --test-case="*Benchmark*" --no-skip`.
+TEST_CASE("[GDSDecomp][TaskManager][Benchmark] Progress reporting overhead on a 200k-item MD5 pass" * doctest::skip()) {
+	constexpr int ELEMENTS = 200000;
+	MD5ProgressBenchmarkTask task;
+	task.paths.resize(ELEMENTS);
+	for (int i = 0; i < ELEMENTS; i++) {
+		task.paths.write[i] = "res://assets/textures/texture_" + itos(i) + ".png";
+	}
+	Vector<String> md5s;
+	md5s.resize(ELEMENTS);
+
+	auto run = [&](bool p_show_progress, uint64_t &r_usec) {
+		task.descriptions = 0;
+		uint64_t start = OS::get_singleton()->get_ticks_usec();
+		Error err = TaskManager::get_singleton()->run_multithreaded_group_task(
+				&task,
+				&MD5ProgressBenchmarkTask::do_task,
+				md5s.ptrw(),
+				ELEMENTS,
+				&MD5ProgressBenchmarkTask::get_description,
+				"MD5ProgressBenchmarkTask",
+				"Hashing...",
+				false, -1, true, nullptr, 0, p_show_progress);
+		r_usec = OS::get_singleton()->get_ticks_usec() - start;
+		CHECK(err == OK);
+		CHECK(md5s[ELEMENTS - 1] == task.paths[ELEMENTS - 1].md5_text());
+	};
+
+	uint64_t without_progress_usec = 0;
+	uint64_t with_progress_usec = 0;
+	run(false, without_progress_usec);
+	run(true, with_progress_usec);
+	int descriptions = task.descriptions.load();
+	// descriptions are only formatted once per refresh interval, not once per item
+	CHECK(descriptions < ELEMENTS / 100);
+	MESSAGE(vformat("200k-item MD5 pass: %d us without progress, %d us with progress (%d descriptions formatted)",
+			without_progress_usec, with_progress_usec, descriptions)
+					.utf8()
+					.get_data());
+}
@@ -0,0 +1,178 @@
+#include "aes_engine.h"
+
+#include "core/crypto/crypto_core.h"
+#include "core/io/file_access_pack.h"
+#include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/thread.h"
+#include "utility/file_access_buffer.h"
+
+namespace {
+struct AESChunkDecryptor {
+	enum Mode {
+		MODE_CFB,
+		MODE_ECB,
+	};
+
+	Mode mode = MODE_CFB;
+	const uint8_t *key = nullptr;
+	uint8_t *data = nullptr;
+	uint64_t size = 0;
+	// CFB decryption of a chunk needs the ciphertext block before it as the IV;
+	// these have to be saved up front since the decryption is done in place.
+	Vector<uint8_t> chunk_ivs;
+	std::atomic<bool> failed = false;
+
+	void decrypt_chunk(uint32_t p_chunk, void *p_userdata = nullptr) {
+		uint64_t start = (uint64_t)p_chunk * AESEngine::CHUNK_SIZE;
+		uint64_t len = MIN(AESEngine::CHUNK_SIZE, size - start);
+		CryptoCore::AESContext ctx;
+		if (mode == MODE_CFB) {
+			// Due to the nature of CFB, same key schedule is used for both encryption and decryption
+			ctx.set_encode_key(key, 256);
+			uint8_t iv[16];
+			memcpy(iv, chunk_ivs.ptr() + p_chunk * 16, 16);
+			if (ctx.decrypt_cfb(len, iv, data + start, data + start) != OK) {
+				failed = true;
+			}
+		} else {
+			ctx.set_decode_key(key, 256);
+			for (uint64_t i = start; i < start + len; i += 16) {
+				if (ctx.decrypt_ecb(data + i, data + i) != OK) {
+					failed = true;
+					return;
+				}
+			}
+		}
+	}
+
+	Error run(const uint8_t p_iv[16], uint64_t p_md5_len, uint8_t *r_md5) {
+		ERR_FAIL_COND_V(size % 16 != 0, ERR_INVALID_PARAMETER);
+		uint32_t num_chunks = (size + AESEngine::CHUNK_SIZE - 1) / AESEngine::CHUNK_SIZE;
+		if (mode == MODE_CFB) {
+			chunk_ivs.resize(num_chunks * 16);
+			memcpy(chunk_ivs.ptrw(), p_iv, 16);
+			for (uint32_t i = 1; i < num_chunks; i++) {
+				memcpy(chunk_ivs.ptrw() + i * 16, data + (uint64_t)i * AESEngine::CHUNK_SIZE - 16, 16);
+			}
+		}
+		CryptoCore::MD5Context md5;
+		if (r_md5) {
+			md5.start();
+		}
+		p_md5_len = MIN(p_md5_len, size);
+		uint64_t hashed = 0;
+		auto hash_up_to = [&](uint64_t p_end) {
+			p_end = MIN(p_end, p_md5_len);
+			if (r_md5 && p_end > hashed) {
+				md5.update(data + hashed, p_end - hashed);
+				hashed = p_end;
+			}
+		};
+
+		// Only fan out from the main thread; callers like the extraction and export tasks are already on pool workers,
+		// and waiting on a nested group task from a worker can deadlock the pool.
+		bool multithread = size >= AESEngine::PARALLEL_THRESHOLD && num_chunks > 1 && Thread::is_main_thread();
+		// Each batch is hashed right after it's decrypted while it's still in cache
+		uint32_t batch_size = multithread ? MAX(1, WorkerThreadPool::get_singleton()->get_thread_count()) * 2 : 1;
+		for (uint32_t batch_start = 0; batch_start < num_chunks && !failed; batch_start += batch_size) {
+			uint32_t batch_len = MIN(batch_size, num_chunks - batch_start);
+			if (batch_len > 1) {
+				struct BatchTask {
+					AESChunkDecryptor *decryptor;
+					uint32_t base;
+					void decrypt(uint32_t p_idx, void *p_userdata) {
+						decryptor->decrypt_chunk(base + p_idx);
+					}
+				} task{ this, batch_start };
+				auto group_id = WorkerThreadPool::get_singleton()->add_template_group_task(
+						&task, &BatchTask::decrypt, (void *)nullptr, batch_len, -1, true, SNAME("AESEngine::decrypt"));
+				WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_id);
+			} else {
+				decrypt_chunk(batch_start);
+			}
+			hash_up_to((uint64_t)(batch_start + batch_len) * AESEngine::CHUNK_SIZE);
+		}
+		ERR_FAIL_COND_V_MSG(failed, ERR_BUG, "AES decryption failed.");
+		if (r_md5) {
+			md5.finish(r_md5);
+		}
+		return OK;
+	}
+};
+} //namespace
+
+Error AESEngine::decrypt_cfb256(const Vector<uint8_t> &p_key, const uint8_t p_iv[16], uint8_t *p_data, uint64_t p_size, uint64_t p_md5_len, uint8_t *r_md5) {
+	ERR_FAIL_COND_V(p_key.size() != 32, ERR_INVALID_PARAMETER);
+	AESChunkDecryptor decryptor;
+	decryptor.mode = AESChunkDecryptor::MODE_CFB;
+	decryptor.key = p_key.ptr();
+	decryptor.data = p_data;
+	decryptor.size = p_size;
+	return decryptor.run(p_iv, p_md5_len, r_md5);
+}
+
+Error AESEngine::decrypt_ecb256(const Vector<uint8_t> &p_key, uint8_t *p_data, uint64_t p_size, uint64_t p_md5_len, uint8_t *r_md5) {
+	ERR_FAIL_COND_V(p_key.size() != 32, ERR_INVALID_PARAMETER);
+	AESChunkDecryptor decryptor;
+	decryptor.mode = AESChunkDecryptor::MODE_ECB;
+	decryptor.key = p_key.ptr();
+	decryptor.data = p_data;
+	decryptor.size = p_size;
+	return decryptor.run(nullptr, p_md5_len, r_md5);
+}
+
+Error AESEngine::decrypt_file(const Ref<FileAccess> &p_base, const Vector<uint8_t> &p_key, bool p_with_magic, Vector<uint8_t> &r_data) {
+	ERR_FAIL_COND_V(p_base.is_null(), ERR_INVALID_PARAMETER);
+	ERR_FAIL_COND_V(p_key.size() != 32, ERR_INVALID_PARAMETER);
+	if (p_with_magic) {
+		uint32_t magic = p_base->get_32();
+		ERR_FAIL_COND_V(magic != 0x43454447, ERR_FILE_UNRECOGNIZED);
+	}
+	uint8_t md5d[16];
+	p_base->get_buffer(md5d, 16);
+	uint64_t length = p_base->get_64();
+	uint8_t iv[16];
+	p_base->get_buffer(iv, 16);
+	uint64_t base = p_base->get_position();
+	ERR_FAIL_COND_V(p_base->get_length() < base + length, ERR_FILE_CORRUPT);
+	uint64_t ds = length;
+	if (ds % 16) {
+		ds += 16 - (ds % 16);
+	}
+	r_data.resize(ds);
+	uint64_t blen = p_base->get_buffer(r_data.ptrw(), ds);
+	ERR_FAIL_COND_V(blen != ds, ERR_FILE_CORRUPT);
+
+	uint8_t hash[16];
+	Error err = decrypt_cfb256(p_key, iv, r_data.ptrw(), ds, length, hash);
+	ERR_FAIL_COND_V(err != OK, err);
+	r_data.resize(length);
+	ERR_FAIL_COND_V_MSG(memcmp(hash, md5d, 16) != 0, ERR_FILE_CORRUPT, "The MD5 sum of the decrypted file does not match the expected value. It could be that the file is corrupt, or that the provided decryption key is invalid.");
+	return OK;
+}
+
+Ref<FileAccess> AESEngine::open_encrypted(const Ref<FileAccess> &p_base, const Vector<uint8_t> &p_key, bool p_with_magic, Error *r_error) {
+	Vector<uint8_t> data;
+	Error err = decrypt_file(p_base, p_key, p_with_magic, data);
+	if (r_error) {
+		*r_error = err;
+	}
+	if (err != OK) {
+		return Ref<FileAccess>();
+	}
+	Ref<FileAccessBuffer> fa = memnew(FileAccessBuffer);
+	fa->open_custom(data);
+	// same as FileAccessEncrypted
+	fa->set_path(p_base->get_path());
+	return fa;
+}
+
+Vector<uint8_t> AESEngine::get_script_encryption_key() {
+	Vector<uint8_t> key;
+	key.resize(32);
+	for (int i = 0; i < key.size(); i++) {
+		key.write[i] = script_encryption_key[i];
+	}
+	return key;
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "core/io/file_access.h"
+#include "core/templates/vector.h"
+
+// Bulk AES-256 decryption for encrypted packs and scripts.
+// Large buffers are split into chunks that are decrypted on the worker thread pool, and the MD5 of the plaintext
+// is computed as each batch of chunks is finished instead of in a separate pass over the whole file.
+// The block cipher itself is mbedTLS (through CryptoCore), which uses AES-NI / ARMv8 crypto extensions when available.
+class AESEngine {
+public:
+	// Buffers smaller than this, or decrypted off the main thread, are decrypted on the calling thread
+	static constexpr uint64_t PARALLEL_THRESHOLD = 4 * 1024 * 1024;
+	static constexpr uint64_t CHUNK_SIZE = 256 * 1024;
+
+	// p_size must be a multiple of 16. If r_md5 is set, it receives the MD5 of the first p_md5_len bytes of plaintext.
+	static Error decrypt_cfb256(const Vector<uint8_t> &p_key, const uint8_t p_iv[16], uint8_t *p_data, uint64_t p_size, uint64_t p_md5_len = 0, uint8_t *r_md5 = nullptr);
+	static Error decrypt_ecb256(const Vector<uint8_t> &p_key, uint8_t *p_data, uint64_t p_size, uint64_t p_md5_len = 0, uint8_t *r_md5 = nullptr);
+
+	// Reads a FileAccessEncrypted (Godot 4.x) stream starting at the current position of p_base, and returns the decrypted contents.
+	static Error decrypt_file(const Ref<FileAccess> &p_base, const Vector<uint8_t> &p_key, bool p_with_magic, Vector<uint8_t> &r_data);
+	// Same as above, but wrapped in a FileAccessBuffer that reports p_base's path. Returns a null Ref on failure.
+	static Ref<FileAccess> open_encrypted(const Ref<FileAccess> &p_base, const Vector<uint8_t> &p_key, bool p_with_magic, Error *r_error = nullptr);
+
+	static Vector<uint8_t> get_script_encryption_key();
+};
@@ -1,17 +1,21 @@
 #include "utility/common.h"
 #include "bytecode/bytecode_base.h"
 #include "compat/file_access_encrypted_v3.h"
+#include "compat/resource_compat_binary.h"
 #include "compat/variant_decoder_compat.h"
 #include "utility/file_access_buffer.h"
 #include "utility/glob.h"
 
+#include "core/crypto/crypto_core.h"
 #include "core/error/error_list.h"
 #include "core/error/error_macros.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
 #include "core/io/http_client.h"
+#include "core/os/thread.h"
 #include "modules/regex/regex.h"
 #include "modules/zip/zip_reader.h"
+#include "utility/gd_parallel_hashmap.h"
 #include "utility/gdre_logger.h"
 #include "utility/task_manager.h"
 
@@ -318,9 +322,89 @@ bool gdre::check_header(const Vector<uint8_t> &p_buffer, const char *p_expected_
 	return true;
 }
 
-void gdre::get_strings_from_variant(const Variant &p_var, Vector<String> &r_strings, const String &engine_version) {
-	// resource_paths are handled seperately, resource_scene_unique_id is generated by Godot and not useful for translation
+namespace {
+// Creating a decompiler is much more expensive than running one, so keep one per thread for each engine version
+ParallelFlatHashMap<Thread::ID, std::shared_ptr<HashMap<String, Ref<GDScriptDecomp>>>> thread_decomps;
+// Embedded scripts tend to be duplicated across scenes; key is engine version + md5 of the source
+ParallelFlatHashMap<String, Vector<String>> script_strings_cache;
+
+// resource_paths are handled seperately, resource_scene_unique_id is generated by Godot and not useful for translation
+const HashSet<String> &get_skip_string_properties() {
 	static const HashSet<String> skip_properties = { "resource_path", "resource_scene_unique_id" };
+	return skip_properties;
+}
+
+Ref<GDScriptDecomp> get_thread_decomp(const String &engine_version) {
+	auto decomps = get_or_create_thread_value(thread_decomps, []() {
+		return std::make_shared<HashMap<String, Ref<GDScriptDecomp>>>();
+	});
+	auto *E = decomps->getptr(engine_version);
+	if (E) {
+		return *E;
+	}
+	// failures are cached too, so an unsupported version isn't retried for every script
+	Ref<GDScriptDecomp> decomp = GDScriptDecomp::create_decomp_for_version(engine_version, true);
+	decomps->insert(engine_version, decomp);
+	return decomp;
+}
+
+void get_strings_from_script_code(const String &code, Vector<String> &r_strings, const String &engine_version) {
+	String key = engine_version + ":" + code.md5_text();
+	bool found = false;
+	script_strings_cache.if_contains(key, [&](const auto &v) {
+		r_strings.append_array(v.second);
+		found = true;
+	});
+	if (found) {
+		return;
+	}
+	Vector<String> strings;
+	auto decomp = get_thread_decomp(engine_version);
+	if (!decomp.is_null()) {
+		auto buf = decomp->compile_code_string(code);
+		if (!buf.is_empty()) {
+			decomp->get_script_strings_from_buf(buf, strings, true);
+		}
+	}
+	script_strings_cache.try_emplace(key, strings);
+	r_strings.append_array(strings);
+}
+} //namespace
+
+void gdre::clear_script_strings_cache() {
+	thread_decomps.clear();
+	script_strings_cache.clear();
+}
+
+Error gdre::get_strings_from_binary_resource(const String &p_path, Vector<String> &r_strings, const String &engine_version) {
+	ResourceLoaderCompatBinary loader;
+	Error err = ResourceFormatLoaderCompatBinary::open_for_streaming(p_path, loader);
+	if (err != OK) {
+		return err;
+	}
+	return loader.stream_properties([&](int p_res_idx, const String &p_res_type, const StringName &p_name, ResourceLoaderCompatBinary &p_loader) -> Error {
+		Variant value;
+		Error e = p_loader.read_variant(value);
+		if (e != OK) {
+			return e;
+		}
+		if (get_skip_string_properties().has(p_name)) {
+			return OK;
+		}
+		// sub-resources are streamed on their own, so don't recurse into any objects here
+		get_strings_from_variant(value, r_strings);
+		if (!engine_version.is_empty() && p_res_type == "GDScript" && p_name == "script/source") {
+			String code = value;
+			if (!code.is_empty()) {
+				get_strings_from_script_code(code, r_strings, engine_version);
+			}
+		}
+		return OK;
+	});
+}
+
+void gdre::get_strings_from_variant(const Variant &p_var, Vector<String> &r_strings, const String &engine_version) {
+	const HashSet<String> &skip_properties = get_skip_string_properties();
 	if (p_var.get_type() == Variant::STRING || p_var.get_type() == Variant::STRING_NAME) {
 		r_strings.push_back(p_var);
 	} else if (p_var.get_type() == Variant::PACKED_STRING_ARRAY) {
@@ -360,13 +444,7 @@ void gdre::get_strings_from_variant(const Variant &p_var, Vector<String> &r_stri
 				if (obj->get_save_class() == "GDScript") {
 					String code = obj->get("script/source");
 					if (!code.is_empty()) {
-						auto decomp = GDScriptDecomp::create_decomp_for_version(engine_version, true);
-						if (!decomp.is_null()) {
-							auto buf = decomp->compile_code_string(code);
-							if (!buf.is_empty()) {
-								decomp->get_script_strings_from_buf(buf, r_strings, true);
-							}
-						}
+						get_strings_from_script_code(code, r_strings, engine_version);
 					}
 				}
 			}
@@ -401,7 +479,97 @@ Error gdre::unzip_file_to_dir(const String &zip_path, const String &output_dir)
 	return OK;
 }
 namespace {
-String get_sha256_for_dir(const String &dir) {
+struct DirTreeHashTaskData {
+	static constexpr int64_t READ_BUFFER_SIZE = 1024 * 1024;
+
+	struct Token {
+		String path;
+		uint8_t digest[32] = {};
+		Error err = OK;
+	};
+	bool sha256 = false;
+
+	void hash_file(uint32_t i, Token *p_tokens) {
+		Token &token = p_tokens[i];
+		Ref<FileAccess> f = FileAccess::open(token.path, FileAccess::READ, &token.err);
+		if (f.is_null()) {
+			if (token.err == OK) {
+				token.err = ERR_FILE_CANT_OPEN;
+			}
+			return;
+		}
+		Vector<uint8_t> buf;
+		buf.resize(MIN(READ_BUFFER_SIZE, MAX((int64_t)f->get_length(), (int64_t)1)));
+		CryptoCore::MD5Context md5;
+		CryptoCore::SHA256Context sha;
+		sha256 ? sha.start() : md5.start();
+		while (true) {
+			uint64_t br = f->get_buffer(buf.ptrw(), buf.size());
+			if (br > 0) {
+				sha256 ? sha.update(buf.ptr(), br) : md5.update(buf.ptr(), br);
+			}
+			if (br < (uint64_t)buf.size()) {
+				break;
+			}
+		}
+		sha256 ? sha.finish(token.digest) : md5.finish(token.digest);
+	}
+
+	String get_step_description(uint32_t i, Token *p_tokens) {
+		return "Hashing " + p_tokens[i].path + "...";
+	}
+
+	// Returns an empty string if any of the files couldn't be read.
+	String run(const String &dir, const Vector<String> &sorted_files) {
+		int digest_len = sha256 ? 32 : 16;
+		Vector<Token> tokens;
+		tokens.resize(sorted_files.size());
+		for (int i = 0; i < sorted_files.size(); i++) {
+			tokens.write[i].path = sorted_files[i];
+		}
+		if (tokens.size() > 1 && Thread::is_main_thread()) {
+			TaskManager::get_singleton()->run_multithreaded_group_task(
+					this, &DirTreeHashTaskData::hash_file,
+					tokens.ptrw(), tokens.size(),
+					&DirTreeHashTaskData::get_step_description,
+					"DirTreeHashTaskData(" + dir + ")", "Hashing " + dir + "...",
+					false, -1, true, nullptr, 0, false);
+		} else {
+			// callers like plugin cache population already run on pool workers
+			for (int i = 0; i < tokens.size(); i++) {
+				hash_file(i, tokens.ptrw());
+			}
+		}
+		// root = H(relative path + '\0' + file digest, for each file in path order)
+		CryptoCore::MD5Context md5;
+		CryptoCore::SHA256Context sha;
+		sha256 ? sha.start() : md5.start();
+		for (const Token &token : tokens) {
+			// leaving the file out would give a wrong digest rather than no digest
+			ERR_FAIL_COND_V_MSG(token.err != OK, "", "Failed to read " + token.path + " while hashing " + dir);
+			CharString rel = token.path.trim_prefix(dir).trim_prefix("/").utf8();
+			sha256 ? sha.update((const uint8_t *)rel.get_data(), rel.length() + 1) : md5.update((const uint8_t *)rel.get_data(), rel.length() + 1);
+			sha256 ? sha.update(token.digest, digest_len) : md5.update(token.digest, digest_len);
+		}
+		uint8_t hash[32];
+		sha256 ? sha.finish(hash) : md5.finish(hash);
+		return String::hex_encode_buffer(hash, digest_len);
+	}
+};
+
+String get_sha256_for_dir(const String &dir, bool p_tree_hash) {
+	if (p_tree_hash) {
+		Vector<String> files;
+		for (auto &path : Glob::rglob(dir.path_join("**/*"), true)) {
+			if (FileAccess::exists(path)) {
+				files.push_back(path);
+			}
+		}
+		files.sort();
+		DirTreeHashTaskData task;
+		task.sha256 = true;
+		return task.run(dir, files);
+	}
 	auto p_file = Glob::rglob(dir.path_join("**/*"), true);
 
 	CryptoCore::SHA256Context ctx;
@@ -433,33 +601,33 @@ String get_sha256_for_dir(const String &dir) {
 }
 } //namespace
 
-String gdre::get_sha256(const String &dir) {
+String gdre::get_sha256(const String &dir, bool p_tree_hash) {
 	if (dir.is_empty()) {
 		return "";
 	}
 	auto da = DirAccess::create_for_path(dir);
 	if (da->dir_exists(dir)) {
-		return get_sha256_for_dir(dir);
+		return get_sha256_for_dir(dir, p_tree_hash);
 	} else if (da->file_exists(dir)) {
 		return FileAccess::get_sha256(dir);
 	}
 	return "";
 }
 
-String gdre::get_md5(const String &dir, bool ignore_code_signature) {
+String gdre::get_md5(const String &dir, bool ignore_code_signature, bool p_tree_hash) {
 	if (dir.is_empty()) {
 		return "";
 	}
 	auto da = DirAccess::create_for_path(dir);
 	if (da->dir_exists(dir)) {
-		return get_md5_for_dir(dir, ignore_code_signature);
+		return get_md5_for_dir(dir, ignore_code_signature, p_tree_hash);
 	} else if (da->file_exists(dir)) {
 		return FileAccess::get_md5(dir);
 	}
 	return "";
 }
 
-String gdre::get_md5_for_dir(const String &dir, bool ignore_code_signature) {
+String gdre::get_md5_for_dir(const String &dir, bool ignore_code_signature, bool p_tree_hash) {
 	auto paths = Glob::rglob(dir.path_join("**/*"), true);
 	Vector<String> files;
 	for (auto path : paths) {
@@ -469,6 +637,10 @@ String gdre::get_md5_for_dir(const String &dir, bool ignore_code_signature) {
 	}
 	// sort the files
 	files.sort();
+	if (p_tree_hash) {
+		DirTreeHashTaskData task;
+		return task.run(dir, files);
+	}
 	return FileAccess::get_multiple_md5(files);
 }
 
@@ -1543,8 +1715,8 @@ void GDRECommon::_bind_methods() {
 	ClassDB::bind_static_method("GDRECommon", D_METHOD("get_recursive_dir_list", "dir", "wildcards", "absolute", "include_hidden"), &gdre::get_recursive_dir_list, DEFVAL(PackedStringArray()), DEFVAL(true), DEFVAL(true));
 	ClassDB::bind_static_method("GDRECommon", D_METHOD("dir_has_any_matching_wildcards", "dir", "wildcards"), &gdre::dir_has_any_matching_wildcards);
 	ClassDB::bind_static_method("GDRECommon", D_METHOD("ensure_dir", "dir"), &gdre::ensure_dir);
-	ClassDB::bind_static_method("GDRECommon", D_METHOD("get_md5", "dir", "ignore_code_signature"), &gdre::get_md5);
-	ClassDB::bind_static_method("GDRECommon", D_METHOD("get_md5_for_dir", "dir", "ignore_code_signature"), &gdre::get_md5_for_dir);
+	ClassDB::bind_static_method("GDRECommon", D_METHOD("get_md5", "dir", "ignore_code_signature", "tree_hash"), &gdre::get_md5, DEFVAL(false), DEFVAL(false));
+	ClassDB::bind_static_method("GDRECommon", D_METHOD("get_md5_for_dir", "dir", "ignore_code_signature", "tree_hash"), &gdre::get_md5_for_dir, DEFVAL(false), DEFVAL(false));
 	// string_has_whitespace, string_is_ascii, detect_utf8, remove_chars, remove_whitespace, split_multichar, rsplit_multichar, has_chars_in_set, get_chars_in_set
 	ClassDB::bind_static_method("GDRECommon", D_METHOD("string_has_whitespace", "str"), &gdre::string_has_whitespace);
 	ClassDB::bind_static_method("GDRECommon", D_METHOD("string_is_ascii", "str"), &gdre::string_is_ascii);
@@ -28,9 +28,14 @@ bool dir_has_any_matching_wildcards(const String &dir, const Vector<String> &wil
 bool check_header(const Vector<uint8_t> &p_buffer, const char *p_expected_header, int p_expected_len);
 Error ensure_dir(const String &dst_dir);
 void get_strings_from_variant(const Variant &p_var, Vector<String> &r_strings, const String &engine_version = "");
-String get_md5(const String &dir, bool ignore_code_signature = false);
-String get_md5_for_dir(const String &dir, bool ignore_code_signature = false);
-String get_sha256(const String &file_or_dir);
+// Like get_strings_from_variant() on the loaded resource, but reads the properties straight out of a binary resource
+Error get_strings_from_binary_resource(const String &p_path, Vector<String> &r_strings, const String &engine_version = "");
+void clear_script_strings_cache();
+// For directories, p_tree_hash hashes each file in parallel and combines the digests in path order (Merkle-style).
+// This is much faster on large directories, but gives a different digest than the default linear hash of all the files concatenated.
+String get_md5(const String &dir, bool ignore_code_signature = false, bool p_tree_hash = false);
+String get_md5_for_dir(const String &dir, bool ignore_code_signature = false, bool p_tree_hash = false);
+String get_sha256(const String &file_or_dir, bool p_tree_hash = false);
 Error unzip_file_to_dir(const String &zip_path, const String &output_dir);
 Error wget_sync(const String &p_url, Vector<uint8_t> &response, int retries = 5, const Vector<String> &extra_headers = {}, float *p_progress = nullptr, bool *p_cancelled = nullptr);
 
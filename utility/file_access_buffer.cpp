@@ -68,6 +68,10 @@ String FileAccessBuffer::get_path() const {
 	return path;
 }
 
+void FileAccessBuffer::set_path(const String &p_path) {
+	path = p_path;
+}
+
 bool FileAccessBuffer::is_open() const {
 	return true;
 }
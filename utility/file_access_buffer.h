@@ -56,6 +56,7 @@ public:
 	virtual Error open_custom(const Vector<uint8_t> &p_data); ///< open a file
 	virtual Error open_internal(const String &p_path, int p_mode_flags) override; ///< open a file
 	virtual String get_path() const override;
+	void set_path(const String &p_path);
 	virtual bool is_open() const override; ///< true when file is open
 
 	virtual void seek(uint64_t p_position) override; ///< seek to a given position
@@ -6,6 +6,7 @@
 #include "core/io/file_access.h"
 #include "core/os/os.h"
 #include "file_access_apk.h"
+#include "file_access_mapped.h"
 #include "gdre_packed_source.h"
 #include "gdre_settings.h"
 #include "packed_file_info.h"
@@ -47,6 +48,12 @@ Ref<FileAccess> DirSource::get_file(const String &p_path, PackedData::PackedFile
 	}
 	if (p_path.begins_with("res://")) {
 		String path = p_file->pack.path_join(p_path.trim_prefix("res://"));
+		if (p_file->size >= FileAccessMapped::MIN_MAPPED_FILE_SIZE) {
+			Ref<FileAccess> mapped = FileAccessMapped::open_view(path);
+			if (mapped.is_valid()) {
+				return mapped;
+			}
+		}
 		return FileAccess::open(path, FileAccess::READ);
 	}
 	return nullptr;
@@ -279,6 +286,75 @@ Vector<Ref<PackedFileInfo>> GDREPackedData::get_file_info_list(const Vector<Stri
 	return ret;
 }
 
+static bool _matches_filters(const String &p_file, const Vector<String> &filters) {
+	if (filters.is_empty()) {
+		return true;
+	}
+	for (const String &filter : filters) {
+		if (p_file.match(filter)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+int64_t GDREPackedData::for_each_file_info(const std::function<bool(const Ref<PackedFileInfo> &)> &p_callback, const Vector<String> &filters, bool p_sorted) const {
+	int64_t count = 0;
+	if (p_sorted) {
+		_for_each_file_sorted(root, "res://", filters, p_callback, count);
+		return count;
+	}
+	for (const auto &E : file_map) {
+		if (!_matches_filters(E.key.get_file(), filters)) {
+			continue;
+		}
+		count++;
+		if (!p_callback(E.value)) {
+			break;
+		}
+	}
+	return count;
+}
+
+bool GDREPackedData::_for_each_file_sorted(PackedDir *p_dir, const String &p_parent_dir, const Vector<String> &filters, const std::function<bool(const Ref<PackedFileInfo> &)> &p_callback, int64_t &r_count) const {
+	// Only the entries of the current directory are held in memory at any one time
+	Vector<String> names;
+	names.resize(p_dir->files.size());
+	{
+		int64_t i = 0;
+		String *names_ptr = names.ptrw();
+		for (const String &E : p_dir->files) {
+			names_ptr[i++] = E;
+		}
+	}
+	names.sort();
+	for (const String &name : names) {
+		if (!_matches_filters(name, filters)) {
+			continue;
+		}
+		const Ref<PackedFileInfo> *info = file_map.getptr(p_parent_dir.path_join(name));
+		if (!info) {
+			continue;
+		}
+		r_count++;
+		if (!p_callback(*info)) {
+			return false;
+		}
+	}
+
+	names.clear();
+	for (const KeyValue<String, PackedDir *> &E : p_dir->subdirs) {
+		names.push_back(E.key);
+	}
+	names.sort();
+	for (const String &name : names) {
+		if (!_for_each_file_sorted(p_dir->subdirs[name], p_parent_dir.path_join(name), filters, p_callback, r_count)) {
+			return false;
+		}
+	}
+	return true;
+}
+
 void GDREPackedData::remove_path(const String &p_path) {
 	String simplified_path = p_path.simplify_path().trim_prefix("res://");
 
@@ -412,6 +488,7 @@ void GDREPackedData::_clear() {
 	}
 	sources.clear();
 	dir_source.reset();
+	FileAccessMapped::release_mappings();
 	set_disabled(true);
 	_free_packed_dirs(root);
 	root = memnew(PackedDir);
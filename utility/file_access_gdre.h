@@ -5,6 +5,8 @@
 #include "core/io/file_access_pack.h"
 #include "utility/packed_file_info.h"
 
+#include <functional>
+
 class DirSource : public PackSource {
 	Vector<String> packs;
 	static DirSource *singleton;
@@ -73,6 +75,7 @@ private:
 
 	void _free_packed_dirs(PackedDir *p_dir);
 	void _get_file_paths(PackedDir *p_dir, const String &p_parent_dir, HashSet<String> &r_paths) const;
+	bool _for_each_file_sorted(PackedDir *p_dir, const String &p_parent_dir, const Vector<String> &filters, const std::function<bool(const Ref<PackedFileInfo> &)> &p_callback, int64_t &r_count) const;
 
 	void _clear();
 
@@ -103,6 +106,9 @@ public:
 	_FORCE_INLINE_ bool has_directory(const String &p_path);
 
 	Vector<Ref<PackedFileInfo>> get_file_info_list(const Vector<String> &filters = Vector<String>());
+	// Calls p_callback for each file matching the filters without building a list; the callback returns false to stop.
+	// Files are visited in pack order, or if p_sorted, in path order (files before subdirectories). Returns the number of files visited.
+	int64_t for_each_file_info(const std::function<bool(const Ref<PackedFileInfo> &)> &p_callback, const Vector<String> &filters = Vector<String>(), bool p_sorted = false) const;
 	static bool real_packed_data_has_pack_loaded();
 	bool has_loaded_packs();
 	String fix_res_path(const String &p_path);
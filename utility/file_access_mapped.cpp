@@ -0,0 +1,300 @@
+#include "file_access_mapped.h"
+
+#if defined(WINDOWS_ENABLED)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#elif defined(UNIX_ENABLED) && !defined(WEB_ENABLED)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+Mutex FileAccessMapped::mappings_mutex;
+HashMap<String, FileAccessMapped::MappingPtr> FileAccessMapped::mappings;
+std::atomic<bool> FileAccessMapped::enabled = true;
+std::atomic<FileAccessMapped::AccessHint> FileAccessMapped::default_hint = FileAccessMapped::ACCESS_HINT_NORMAL;
+
+FileAccessMapped::Mapping::~Mapping() {
+#if defined(WINDOWS_ENABLED)
+	if (data) {
+		UnmapViewOfFile(data);
+	}
+	if (map_handle) {
+		CloseHandle(map_handle);
+	}
+	if (file_handle) {
+		CloseHandle(file_handle);
+	}
+#elif defined(UNIX_ENABLED) && !defined(WEB_ENABLED)
+	if (data) {
+		munmap(data, size);
+	}
+#endif
+}
+
+bool FileAccessMapped::_get_file_stamp(const String &p_path, uint64_t &r_size, uint64_t &r_modified_time) {
+#if defined(WINDOWS_ENABLED)
+	WIN32_FILE_ATTRIBUTE_DATA attributes;
+	if (!GetFileAttributesExW((LPCWSTR)(p_path.replace("/", "\\").utf16().get_data()), GetFileExInfoStandard, &attributes)) {
+		return false;
+	}
+	r_size = ((uint64_t)attributes.nFileSizeHigh << 32) | attributes.nFileSizeLow;
+	r_modified_time = ((uint64_t)attributes.ftLastWriteTime.dwHighDateTime << 32) | attributes.ftLastWriteTime.dwLowDateTime;
+	return true;
+#elif defined(UNIX_ENABLED) && !defined(WEB_ENABLED)
+	struct stat st;
+	if (stat(p_path.utf8().get_data(), &st) != 0) {
+		return false;
+	}
+	r_size = st.st_size;
+	r_modified_time = st.st_mtime;
+	return true;
+#else
+	return false;
+#endif
+}
+
+void FileAccessMapped::_advise(const uint8_t *p_data, uint64_t p_length, AccessHint p_hint) {
+#if defined(UNIX_ENABLED) && !defined(WEB_ENABLED)
+	if (!p_data || p_length == 0) {
+		return;
+	}
+	// madvise wants a page-aligned start
+	uint64_t page_size = sysconf(_SC_PAGESIZE);
+	uintptr_t start = (uintptr_t)p_data & ~(uintptr_t)(page_size - 1);
+	size_t len = p_length + ((uintptr_t)p_data - start);
+	int advice = MADV_NORMAL;
+	if (p_hint == ACCESS_HINT_SEQUENTIAL) {
+		advice = MADV_SEQUENTIAL;
+	} else if (p_hint == ACCESS_HINT_RANDOM) {
+		advice = MADV_RANDOM;
+	}
+	madvise((void *)start, len, advice);
+#endif
+}
+
+FileAccessMapped::MappingPtr FileAccessMapped::_map_file(const String &p_path) {
+	MappingPtr mapping = std::make_shared<Mapping>();
+	mapping->path = p_path;
+	uint64_t stamp_size = 0;
+	if (!_get_file_stamp(p_path, stamp_size, mapping->modified_time)) {
+		return nullptr;
+	}
+#if defined(WINDOWS_ENABLED)
+	// like FileAccessWindows, don't stop anything else from rewriting, renaming or deleting the file while it's mapped
+	HANDLE fh = CreateFileW((LPCWSTR)(p_path.replace("/", "\\").utf16().get_data()), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (fh == INVALID_HANDLE_VALUE) {
+		return nullptr;
+	}
+	mapping->file_handle = fh;
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(fh, &size) || size.QuadPart == 0) {
+		return nullptr;
+	}
+	mapping->size = size.QuadPart;
+	mapping->map_handle = CreateFileMappingW(fh, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!mapping->map_handle) {
+		return nullptr;
+	}
+	mapping->data = (uint8_t *)MapViewOfFile(mapping->map_handle, FILE_MAP_READ, 0, 0, 0);
+	if (!mapping->data) {
+		return nullptr;
+	}
+#elif defined(UNIX_ENABLED) && !defined(WEB_ENABLED)
+	int fd = ::open(p_path.utf8().get_data(), O_RDONLY);
+	if (fd < 0) {
+		return nullptr;
+	}
+	struct stat st;
+	if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size == 0) {
+		::close(fd);
+		return nullptr;
+	}
+	void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	// the mapping stays valid after the descriptor is closed
+	::close(fd);
+	if (data == MAP_FAILED) {
+		return nullptr;
+	}
+	mapping->data = (uint8_t *)data;
+	mapping->size = st.st_size;
+#else
+	return nullptr;
+#endif
+	// changed between the stamp and the mapping; let the next open try again
+	if (mapping->size != stamp_size) {
+		return nullptr;
+	}
+	_advise(mapping->data, mapping->size, default_hint);
+	return mapping;
+}
+
+FileAccessMapped::MappingPtr FileAccessMapped::_get_mapping(const String &p_path) {
+	MutexLock lock(mappings_mutex);
+	MappingPtr *existing = mappings.getptr(p_path);
+	if (existing) {
+		// the file may have been rewritten since it was mapped (e.g. a pck re-created from the GUI);
+		// reading past the end of a truncated MAP_SHARED mapping would fault, so map it again
+		uint64_t size = 0;
+		uint64_t modified_time = 0;
+		if (_get_file_stamp(p_path, size, modified_time) && size == (*existing)->size && modified_time == (*existing)->modified_time) {
+			return *existing;
+		}
+		// views that are still open keep the old mapping alive until they're closed
+		mappings.erase(p_path);
+	}
+	MappingPtr mapping = _map_file(p_path);
+	if (mapping) {
+		mappings[p_path] = mapping;
+	}
+	return mapping;
+}
+
+Ref<FileAccessMapped> FileAccessMapped::open_view(const String &p_path, uint64_t p_offset, int64_t p_size, const String &p_view_path) {
+	if (!enabled || p_path.is_empty() || p_path.contains("://")) {
+		return Ref<FileAccessMapped>();
+	}
+	MappingPtr mapping = _get_mapping(p_path);
+	if (!mapping || p_offset > mapping->size) {
+		return Ref<FileAccessMapped>();
+	}
+	uint64_t size = p_size < 0 ? mapping->size - p_offset : (uint64_t)p_size;
+	if (p_offset + size > mapping->size) {
+		return Ref<FileAccessMapped>();
+	}
+	Ref<FileAccessMapped> fa = memnew(FileAccessMapped);
+	fa->mapping = mapping;
+	fa->path = p_view_path.is_empty() ? p_path : p_view_path;
+	fa->data = mapping->data + p_offset;
+	fa->length = size;
+	return fa;
+}
+
+void FileAccessMapped::release_mappings() {
+	MutexLock lock(mappings_mutex);
+	mappings.clear();
+}
+
+void FileAccessMapped::set_enabled(bool p_enabled) {
+	enabled = p_enabled;
+	if (!enabled) {
+		release_mappings();
+	}
+}
+
+bool FileAccessMapped::is_enabled() {
+	return enabled;
+}
+
+void FileAccessMapped::set_default_access_hint(AccessHint p_hint) {
+	MutexLock lock(mappings_mutex);
+	default_hint = p_hint;
+	for (const auto &E : mappings) {
+		_advise(E.value->data, E.value->size, p_hint);
+	}
+}
+
+FileAccessMapped::AccessHint FileAccessMapped::get_default_access_hint() {
+	return default_hint;
+}
+
+void FileAccessMapped::set_access_hint(AccessHint p_hint) {
+	ERR_FAIL_COND(!data);
+	_advise(data, length, p_hint);
+}
+
+Error FileAccessMapped::open_internal(const String &p_path, int p_mode_flags) {
+	ERR_FAIL_COND_V_MSG(p_mode_flags != READ, ERR_UNAVAILABLE, "FileAccessMapped is read-only.");
+	close();
+	MappingPtr new_mapping = _get_mapping(p_path);
+	if (!new_mapping) {
+		return ERR_FILE_CANT_OPEN;
+	}
+	mapping = new_mapping;
+	path = p_path;
+	data = mapping->data;
+	length = mapping->size;
+	return OK;
+}
+
+bool FileAccessMapped::is_open() const {
+	return data != nullptr;
+}
+
+void FileAccessMapped::seek(uint64_t p_position) {
+	ERR_FAIL_COND(!data);
+	pos = p_position;
+	eof = false;
+}
+
+void FileAccessMapped::seek_end(int64_t p_position) {
+	ERR_FAIL_COND(!data);
+	seek(length + p_position);
+}
+
+uint64_t FileAccessMapped::get_position() const {
+	ERR_FAIL_COND_V(!data, 0);
+	return pos;
+}
+
+uint64_t FileAccessMapped::get_length() const {
+	ERR_FAIL_COND_V(!data, 0);
+	return length;
+}
+
+bool FileAccessMapped::eof_reached() const {
+	return eof;
+}
+
+uint8_t FileAccessMapped::get_8() const {
+	ERR_FAIL_COND_V(!data, 0);
+	if (pos >= length) {
+		eof = true;
+		return 0;
+	}
+	return data[pos++];
+}
+
+uint64_t FileAccessMapped::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
+	if (!p_length) {
+		return 0;
+	}
+	ERR_FAIL_NULL_V(p_dst, -1);
+	ERR_FAIL_COND_V(!data, -1);
+
+	uint64_t left = pos < length ? length - pos : 0;
+	uint64_t read = MIN(p_length, left);
+	if (read < p_length) {
+		eof = true;
+	}
+	if (read > 0) {
+		memcpy(p_dst, data + pos, read);
+		pos += read;
+	}
+	return read;
+}
+
+Error FileAccessMapped::get_error() const {
+	return eof ? ERR_FILE_EOF : OK;
+}
+
+bool FileAccessMapped::store_buffer(const uint8_t *p_src, uint64_t p_length) {
+	ERR_FAIL_V_MSG(false, "FileAccessMapped is read-only.");
+}
+
+bool FileAccessMapped::file_exists(const String &p_name) {
+	return FileAccess::exists(p_name);
+}
+
+void FileAccessMapped::close() {
+	mapping.reset();
+	data = nullptr;
+	length = 0;
+	pos = 0;
+	eof = false;
+}
+
+FileAccessMapped::~FileAccessMapped() {
+	close();
+}
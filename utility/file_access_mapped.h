@@ -0,0 +1,112 @@
+#pragma once
+
+#include "core/io/file_access.h"
+#include "core/os/mutex.h"
+#include "core/templates/hash_map.h"
+
+#include <atomic>
+#include <memory>
+
+// Read-only FileAccess over a window of a memory-mapped file.
+// All FileAccessMapped instances for the same file share a single mapping, so concurrent readers don't each need their own OS handle.
+class FileAccessMapped : public FileAccess {
+	GDSOFTCLASS(FileAccessMapped, FileAccess);
+
+public:
+	enum AccessHint {
+		ACCESS_HINT_NORMAL,
+		ACCESS_HINT_SEQUENTIAL,
+		ACCESS_HINT_RANDOM,
+	};
+
+	struct Mapping {
+		String path;
+		uint8_t *data = nullptr;
+		uint64_t size = 0;
+		// the file's modified time when it was mapped; a mapping is only reused while the file's size and modified time match
+		uint64_t modified_time = 0;
+#ifdef WINDOWS_ENABLED
+		void *file_handle = nullptr;
+		void *map_handle = nullptr;
+#endif
+		~Mapping();
+	};
+	typedef std::shared_ptr<Mapping> MappingPtr;
+
+private:
+	static Mutex mappings_mutex;
+	static HashMap<String, MappingPtr> mappings;
+	static std::atomic<bool> enabled;
+	static std::atomic<AccessHint> default_hint;
+
+	MappingPtr mapping;
+	String path;
+	const uint8_t *data = nullptr;
+	uint64_t length = 0;
+	mutable uint64_t pos = 0;
+	mutable bool eof = false;
+
+	static bool _get_file_stamp(const String &p_path, uint64_t &r_size, uint64_t &r_modified_time);
+	static void _advise(const uint8_t *p_data, uint64_t p_length, AccessHint p_hint);
+	static MappingPtr _map_file(const String &p_path);
+	static MappingPtr _get_mapping(const String &p_path);
+
+public:
+	// Files smaller than this aren't worth a mapping of their own
+	static constexpr uint64_t MIN_MAPPED_FILE_SIZE = 64 * 1024;
+
+	// Returns a null Ref if the file can't be mapped (or mapping is disabled) so that the caller can fall back to a regular FileAccess.
+	// p_size of -1 maps from p_offset to the end of the file.
+	// p_view_path is what get_path() reports (e.g. the res:// path of a packed file); defaults to p_path.
+	static Ref<FileAccessMapped> open_view(const String &p_path, uint64_t p_offset = 0, int64_t p_size = -1, const String &p_view_path = String());
+	// Drops the shared mappings; views that are still open keep theirs alive until they're closed.
+	static void release_mappings();
+	static void set_enabled(bool p_enabled);
+	static bool is_enabled();
+	// Hint applied to every mapping, current and future (e.g. sequential while a whole pack is being extracted).
+	static void set_default_access_hint(AccessHint p_hint);
+	static AccessHint get_default_access_hint();
+
+	// Hint for this view's window only. Only has an effect where madvise is available.
+	void set_access_hint(AccessHint p_hint);
+
+	virtual Error open_internal(const String &p_path, int p_mode_flags) override;
+	virtual bool is_open() const override;
+	virtual String get_path() const override { return path; }
+	virtual String get_path_absolute() const override { return path; }
+
+	virtual void seek(uint64_t p_position) override;
+	virtual void seek_end(int64_t p_position = 0) override;
+	virtual uint64_t get_position() const override;
+	virtual uint64_t get_length() const override;
+
+	virtual bool eof_reached() const override;
+
+	virtual uint8_t get_8() const override;
+	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+
+	virtual Error get_error() const override;
+
+	virtual Error resize(int64_t p_length) override { return ERR_UNAVAILABLE; }
+	virtual void flush() override {}
+	virtual bool store_buffer(const uint8_t *p_src, uint64_t p_length) override;
+
+	virtual bool file_exists(const String &p_name) override;
+
+	virtual uint64_t _get_modified_time(const String &p_file) override { return 0; }
+	virtual uint64_t _get_access_time(const String &p_file) override { return 0; }
+	virtual int64_t _get_size(const String &p_file) override { return -1; }
+
+	virtual BitField<FileAccess::UnixPermissionFlags> _get_unix_permissions(const String &p_file) override { return 0; }
+	virtual Error _set_unix_permissions(const String &p_file, BitField<FileAccess::UnixPermissionFlags> p_permissions) override { return FAILED; }
+
+	virtual bool _get_hidden_attribute(const String &p_file) override { return false; }
+	virtual Error _set_hidden_attribute(const String &p_file, bool p_hidden) override { return ERR_UNAVAILABLE; }
+	virtual bool _get_read_only_attribute(const String &p_file) override { return true; }
+	virtual Error _set_read_only_attribute(const String &p_file, bool p_ro) override { return ERR_UNAVAILABLE; }
+
+	virtual void close() override;
+
+	FileAccessMapped() = default;
+	~FileAccessMapped();
+};
@@ -3,6 +3,7 @@
 #define GD_PARALLEL_HASHMAP_H
 
 #include "core/os/mutex.h"
+#include "core/os/thread.h"
 #include "external/parallel_hashmap/phmap.h"
 #include "std_allocator.h"
 #include "std_hash.h"
@@ -74,4 +75,20 @@ template <class Key, class Value,
 		class Mutex = BinaryMutex> // use std::mutex to enable internal locks
 using ParallelNodeHashMap = phmap::parallel_node_hash_map<Key, Value, Hash, Eq, Alloc, N, Mutex>;
 
+// Returns the calling thread's value in a per-thread map, creating it with `p_create()` on first use.
+// Each thread only ever inserts its own key, so the value itself can be used without further locking by that thread.
+template <class V, class F>
+V get_or_create_thread_value(ParallelFlatHashMap<Thread::ID, V> &p_map, F &&p_create) {
+	auto thread_id = Thread::get_caller_id();
+	V value;
+	bool found = p_map.if_contains(thread_id, [&](const auto &v) {
+		value = v.second;
+	});
+	if (!found) {
+		value = p_create();
+		p_map.try_emplace(thread_id, value);
+	}
+	return value;
+}
+
 #endif //GD_PARALLEL_HASHMAP_H
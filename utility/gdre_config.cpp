@@ -226,6 +226,26 @@ Vector<Ref<GDREConfigSetting>> GDREConfig::_init_default_settings() {
 				"Force single-threaded mode",
 				"Forces all tasks to run on the main thread",
 				false)),
+		memnew(GDREConfigSetting(
+				"progress_update_interval_ms",
+				"Progress update interval (ms)",
+				"How often progress is refreshed while waiting for tasks to complete.\nTask completion itself is signaled immediately regardless of this value.",
+				10)),
+		memnew(GDREConfigSetting(
+				"memory_map_packs",
+				"Memory-map packs",
+				"Read local, unencrypted packs and directories through a shared read-only memory mapping instead of regular file handles.",
+				true)),
+		memnew(GDREConfigSetting(
+				"shared_resource_cache_size_mb",
+				"Shared resource cache size (MB)",
+				"The maximum estimated size of resources kept loaded during export so that exporters can share them instead of reloading them.\nSet to 0 to disable.",
+				256)),
+		memnew(GDREConfigSetting(
+				"cache_version_detection",
+				"Cache version detection",
+				"Caches the engine version and bytecode revision detected for a game,\nso that subsequent loads of the same game can skip probing its resources and scripts.",
+				true)),
 		memnew(GDREConfigSetting(
 				"write_json_report",
 				"Write JSON report",
@@ -249,6 +269,16 @@ Vector<Ref<GDREConfigSetting>> GDREConfig::_init_default_settings() {
 				"Use scene view by default",
 				"Use scene view by default instead of the text preview.\nWARNING: Scene view is still experimental and certain scenes may cause the program to become unresponsive.",
 				false)),
+		memnew(GDREConfigSetting(
+				"Preview/preview_worker_threads",
+				"Preview worker threads",
+				"The number of background threads used to decompile scripts and generate thumbnails for the preview.\nTakes effect on restart.",
+				2)),
+		memnew(GDREConfigSetting(
+				"Preview/preview_cache_size_mb",
+				"Preview cache size (MB)",
+				"The maximum estimated size of decompiled scripts and thumbnails kept in memory for the preview.\nSet to 0 to disable.",
+				64)),
 		memnew(GDREConfigSetting_BytecodeForceBytecodeRevision()),
 		memnew(GDREConfigSetting_LoadCustomBytecode()),
 #if !GODOT_MONO_DECOMP_DISABLED
@@ -312,6 +342,11 @@ Vector<Ref<GDREConfigSetting>> GDREConfig::_init_default_settings() {
 				"Ignore missing dependencies",
 				"Ignore missing dependencies when exporting the scene.",
 				false)),
+		memnew(GDREConfigSetting(
+				"Exporter/Scene/max_shared_dependencies_kept_loaded",
+				"Max shared dependencies kept loaded",
+				"The maximum number of resources shared between scenes (textures, meshes, materials, instanced scenes) to keep loaded during scene export,\nso that they don't have to be reloaded for every scene that uses them.\nSet to 0 to disable.",
+				256)),
 		memnew(GDREConfigSetting(
 				"Exporter/Scene/GLTF/remove_physics_bodies",
 				"Remove physics bodies",
@@ -345,6 +380,11 @@ Vector<Ref<GDREConfigSetting>> GDREConfig::_init_default_settings() {
 				false,
 				false,
 				true)),
+		memnew(GDREConfigSetting(
+				"Exporter/Translation/cache_resource_strings",
+				"Cache resource strings",
+				"Caches the strings collected from all resources during translation recovery,\nso that subsequent recoveries of the same game can skip loading them again.",
+				true)),
 		memnew(GDREConfigSetting(
 				"Exporter/Translation/dump_resource_strings",
 				"Dump resource strings",
@@ -6,6 +6,9 @@
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_pack.h"
 #include "core/object/script_language.h"
+#include "utility/aes_engine.h"
+#include "utility/file_access_buffer.h"
+#include "utility/file_access_mapped.h"
 #include "utility/file_access_patched_gdre.h"
 
 static_assert(PACK_FORMAT_VERSION == GDREPackedSource::CURRENT_PACK_FORMAT_VERSION, "Pack format version changed.");
@@ -357,19 +360,8 @@ bool GDREPackedSource::try_open_pack(const String &p_path, bool p_replace_files,
 
 	uint32_t file_count = f->get_32();
 	if (enc_directory) {
-		Ref<FileAccessEncrypted> fae = memnew(FileAccessEncrypted);
-		if (fae.is_null()) {
-			GDRESettings::get_singleton()->_set_error_encryption(true);
-			ERR_FAIL_V_MSG(false, "Failed to instance FileAccessEncrypted??????.");
-		}
-
-		Vector<uint8_t> key;
-		key.resize(32);
-		for (int i = 0; i < key.size(); i++) {
-			key.write[i] = script_encryption_key[i];
-		}
-
-		Error err = fae->open_and_parse(f, key, FileAccessEncrypted::MODE_READ, false);
+		Error err;
+		Ref<FileAccess> fae = AESEngine::open_encrypted(f, AESEngine::get_script_encryption_key(), false, &err);
 		if (err) {
 			GDRESettings::get_singleton()->_set_error_encryption(true);
 			ERR_FAIL_V_MSG(false, "Can't open encrypted pack directory (PCK format version " + itos(version) + ", engine version " + itos(ver_major) + "." + itos(ver_minor) + "." + itos(ver_patch) + ").");
@@ -456,23 +448,34 @@ Ref<FileAccess> GDREPackedSource::get_file(const String &p_path, PackedData::Pac
 		ERR_FAIL_COND_V_MSG(file.is_null(), nullptr, vformat("APKArchive or DirSource doesn't contain sparse pack-referenced file '%s'.", p_path));
 
 		if (pf.encrypted) {
-			Ref<FileAccessEncrypted> fae;
-			fae.instantiate();
-			ERR_FAIL_COND_V_MSG(fae.is_null(), nullptr, vformat("Can't open encrypted pack-referenced file '%s'.", String(p_path)));
-
-			Vector<uint8_t> key;
-			key.resize(32);
-			for (int i = 0; i < key.size(); i++) {
-				key.write[i] = script_encryption_key[i];
-			}
-
-			Error err = fae->open_and_parse(file, key, FileAccessEncrypted::MODE_READ, false);
+			Error err;
+			file = AESEngine::open_encrypted(file, AESEngine::get_script_encryption_key(), false, &err);
 			ERR_FAIL_COND_V_MSG(err, nullptr, vformat("Can't open encrypted pack-referenced file '%s'.", String(p_path)));
-			file = fae;
 		}
 	} else {
 		// otherwise...
-		file = Ref<FileAccess>(memnew(FileAccessPack(p_path, *p_file)));
+		if (!p_file->encrypted) {
+			file = FileAccessMapped::open_view(p_file->pack, p_file->offset, p_file->size, p_path);
+		} else {
+			Ref<FileAccess> base = FileAccessMapped::open_view(p_file->pack, p_file->offset, -1, p_path);
+			if (base.is_null()) {
+				base = FileAccess::open(p_file->pack, FileAccess::READ);
+				if (base.is_valid()) {
+					base->seek(p_file->offset);
+				}
+			}
+			if (base.is_valid()) {
+				// a decryption failure (e.g. wrong key) is final; FileAccessPack would just fail the same way
+				Error err;
+				file = AESEngine::open_encrypted(base, AESEngine::get_script_encryption_key(), false, &err);
+				ERR_FAIL_COND_V_MSG(err, nullptr, vformat("Can't open encrypted pack file '%s'.", p_path));
+				Ref<FileAccessBuffer>(file)->set_path(p_path);
+			}
+		}
+		// only if the fast paths couldn't be used (e.g. the pack couldn't be opened directly)
+		if (file.is_null()) {
+			file = Ref<FileAccess>(memnew(FileAccessPack(p_path, *p_file)));
+		}
 	}
 
 	if (GDREPackedData::get_singleton()->has_delta_patches(p_path)) {
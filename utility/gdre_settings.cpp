@@ -3,6 +3,7 @@
 #include "bytecode/bytecode_base.h"
 #include "bytecode/bytecode_tester.h"
 #include "compat/config_file_compat.h"
+#include "compat/resource_cache_compat.h"
 #include "compat/resource_compat_binary.h"
 #include "compat/resource_loader_compat.h"
 #include "core/error/error_list.h"
@@ -13,11 +14,13 @@
 #include "core/object/class_db.h"
 #include "core/string/print_string.h"
 #include "exporters/translation_exporter.h"
+#include "gui/gdre_preview_service.h"
 #include "main/main.h"
 #include "modules/zip/zip_reader.h"
 #include "plugin_manager/plugin_manager.h"
 #include "utility/common.h"
 #include "utility/file_access_gdre.h"
+#include "utility/file_access_mapped.h"
 #include "utility/gdre_logger.h"
 #include "utility/gdre_packed_source.h"
 #include "utility/gdre_version.gen.h"
@@ -698,6 +701,7 @@ Error GDRESettings::load_project(const Vector<String> &p_paths, bool _cmd_line_e
 		log_sysinfo();
 	}
 	load_encryption_key();
+	FileAccessMapped::set_enabled(GDREConfig::get_singleton()->get_setting("memory_map_packs", true));
 
 	Error err = ERR_CANT_OPEN;
 	Vector<String> pck_files = sort_and_validate_pck_files(p_paths);
@@ -744,7 +748,17 @@ Error GDRESettings::_project_post_load(bool initial_load, const String &csharp_a
 	// If we don't have a valid version, we need to detect it from the binary resources.
 	bool invalid_ver = !has_valid_version() || current_project->suspect_version;
 
-	if (invalid_ver) {
+	// Version detection has to probe a lot of files; reuse the results from a previous load of the same packs
+	String version_cache_path = GDREConfig::get_singleton()->get_setting("cache_version_detection", true) ? get_version_cache_path() : "";
+	bool version_cached = false;
+	if (!version_cache_path.is_empty() && FileAccess::exists(version_cache_path)) {
+		version_cached = load_version_cache(version_cache_path, invalid_ver);
+		if (version_cached) {
+			print_verbose("Loaded detected version from cache");
+		}
+	}
+
+	if (invalid_ver && !version_cached) {
 		err = get_version_from_bin_resources();
 		if (err) {
 			// Without a valid version, we can't do resource export or decompilation; unload the pack
@@ -755,12 +769,14 @@ Error GDRESettings::_project_post_load(bool initial_load, const String &csharp_a
 	}
 
 	// Detect the bytecode revision
-	err = detect_bytecode_revision(invalid_ver);
+	err = detect_bytecode_revision(invalid_ver && !version_cached);
 	if (err) {
 		if (err == ERR_UNAUTHORIZED) {
 			_set_error_encryption(true);
 		}
 		WARN_PRINT("Could not determine bytecode revision, not able to decompile scripts...");
+	} else if (!version_cache_path.is_empty() && !version_cached) {
+		save_version_cache(version_cache_path, invalid_ver);
 	}
 
 	// Load the project config if it exists
@@ -977,6 +993,31 @@ int GDRESettings::get_bytecode_revision() const {
 	return is_pack_loaded() ? current_project->bytecode_revision : 0;
 }
 
+namespace {
+// Once this many resources agree on the version with no conflicts, the rest won't change the result
+constexpr int64_t VERSION_PROBE_QUORUM = 256;
+constexpr int64_t VERSION_PROBE_BATCH_SIZE = 128;
+
+struct VersionProbeTask {
+	struct Token {
+		String path;
+		uint32_t ver_major = 0;
+		uint32_t ver_minor = 0;
+		bool suspicious = false;
+		Error err = ERR_UNCONFIGURED;
+	};
+
+	void do_task(uint32_t i, Token *tokens) {
+		Token &token = tokens[i];
+		token.err = ResourceFormatLoaderCompatBinary::get_ver_major_minor(token.path, token.ver_major, token.ver_minor, token.suspicious);
+	}
+
+	String get_description(uint32_t i, Token *tokens) {
+		return tokens[i].path;
+	}
+};
+} //namespace
+
 Error GDRESettings::get_version_from_bin_resources() {
 	int consistent_versions = 0;
 	int inconsistent_versions = 0;
@@ -1057,40 +1098,67 @@ Error GDRESettings::get_version_from_bin_resources() {
 	int64_t max = files.size();
 	bool sus_warning = false;
 
-	for (int64_t i = 0; i < max; i++) {
-		bool suspicious = false;
-		uint32_t res_major = 0;
-		uint32_t res_minor = 0;
-		Error err = ResourceFormatLoaderCompatBinary::get_ver_major_minor(files[i], res_major, res_minor, suspicious);
-		if (err) {
-			continue;
+	// Headers are probed in parallel batches, but tallied in file order
+	VersionProbeTask probe_task;
+	Vector<VersionProbeTask::Token> tokens;
+	for (int64_t batch_start = 0; batch_start < max; batch_start += VERSION_PROBE_BATCH_SIZE) {
+		if (consistent_versions >= VERSION_PROBE_QUORUM && inconsistent_versions == 0) {
+			break;
 		}
-		if (!sus_warning && suspicious) {
-			if (res_major == 3 && res_minor == 1) {
-				WARN_PRINT("Warning: Found suspicious major/minor version, probably Sonic Colors Unlimited...");
-				max = 1000;
-			} else {
-				WARN_PRINT("Warning: Found suspicious major/minor version...");
-			}
-			sus_warning = true;
+		int64_t batch_end = MIN(max, batch_start + VERSION_PROBE_BATCH_SIZE);
+		tokens.resize(batch_end - batch_start);
+		for (int64_t i = batch_start; i < batch_end; i++) {
+			tokens.write[i - batch_start] = VersionProbeTask::Token{ files[i] };
 		}
-		if (consistent_versions == 0) {
-			ver_major = res_major;
-			ver_minor = res_minor;
-		}
-		if (ver_major == res_major && res_minor == ver_minor) {
-			consistent_versions++;
-		} else {
-			if (ver_major != res_major) {
-				WARN_PRINT_ONCE("WARNING!!!!! Inconsistent major versions in binary resources!");
-				if (ver_major < res_major) {
-					ver_major = res_major;
-					ver_minor = res_minor;
+		TaskManager::get_singleton()->run_multithreaded_group_task(
+				&probe_task,
+				&VersionProbeTask::do_task,
+				tokens.ptrw(),
+				tokens.size(),
+				&VersionProbeTask::get_description,
+				"GDRESettings::get_version_from_bin_resources",
+				RTR("Detecting engine version..."),
+				false,
+				-1,
+				true,
+				nullptr,
+				0,
+				false);
+
+		for (int64_t i = batch_start; i < batch_end && i < max; i++) {
+			const auto &token = tokens[i - batch_start];
+			if (token.err) {
+				continue;
+			}
+			uint32_t res_major = token.ver_major;
+			uint32_t res_minor = token.ver_minor;
+			if (!sus_warning && token.suspicious) {
+				if (res_major == 3 && res_minor == 1) {
+					WARN_PRINT("Warning: Found suspicious major/minor version, probably Sonic Colors Unlimited...");
+					max = 1000;
+				} else {
+					WARN_PRINT("Warning: Found suspicious major/minor version...");
 				}
-			} else if (ver_minor < res_minor) {
+				sus_warning = true;
+			}
+			if (consistent_versions == 0) {
+				ver_major = res_major;
 				ver_minor = res_minor;
 			}
-			inconsistent_versions++;
+			if (ver_major == res_major && res_minor == ver_minor) {
+				consistent_versions++;
+			} else {
+				if (ver_major != res_major) {
+					WARN_PRINT_ONCE("WARNING!!!!! Inconsistent major versions in binary resources!");
+					if (ver_major < res_major) {
+						ver_major = res_major;
+						ver_minor = res_minor;
+					}
+				} else if (ver_minor < res_minor) {
+					ver_minor = res_minor;
+				}
+				inconsistent_versions++;
+			}
 		}
 	}
 	if (inconsistent_versions > 0) {
@@ -1149,10 +1217,22 @@ Error GDRESettings::unload_project(bool p_no_reset_ephemeral) {
 	_clear_shader_globals();
 	error_encryption = false;
 
+	// previews read from the packs we're about to remove, so drop the queued ones and wait for the running ones to finish
+	GDREPreviewService *preview_service = GDREPreviewService::get_singleton();
+	if (preview_service) {
+		preview_service->cancel_all_requests();
+		preview_service->pause_and_wait_idle();
+	}
 	remove_current_pack();
 	GDREPackedData::get_singleton()->clear();
+	ResourceCacheCompat::clear();
 	reset_uid_cache();
 	reset_gdscript_cache();
+	gdre::clear_script_strings_cache();
+	if (preview_service) {
+		preview_service->clear_cache();
+		preview_service->set_paused(false);
+	}
 	if (!p_no_reset_ephemeral && GDREConfig::get_singleton()) {
 		GDREConfig::get_singleton()->reset_ephemeral_settings();
 	}
@@ -1337,6 +1417,21 @@ Vector<Ref<PackedFileInfo>> GDRESettings::get_file_info_list(const Vector<String
 	return GDREPackedData::get_singleton()->get_file_info_list(filters);
 }
 
+int64_t GDRESettings::for_each_file(const Callable &p_callback, const Vector<String> &filters, bool p_sorted) {
+	ERR_FAIL_COND_V_MSG(!p_callback.is_valid(), 0, "Invalid callback");
+	return GDREPackedData::get_singleton()->for_each_file_info([&](const Ref<PackedFileInfo> &p_info) {
+		Variant path = p_info->get_path();
+		const Variant *args[1] = { &path };
+		Variant ret;
+		Callable::CallError ce;
+		p_callback.callp(args, 1, ret, ce);
+		ERR_FAIL_COND_V_MSG(ce.error != Callable::CallError::CALL_OK, false, "Error calling file callback: " + Variant::get_callable_error_text(p_callback, args, 1, ce));
+		// Anything other than an explicit `false` continues the iteration
+		return ret.get_type() != Variant::BOOL || bool(ret);
+	},
+			filters, p_sorted);
+}
+
 TypedArray<GDRESettings::PackInfo> GDRESettings::get_pack_info_list() const {
 	TypedArray<PackInfo> ret;
 	for (const auto &pack : packs) {
@@ -2161,7 +2256,8 @@ String GDRESettings::get_IInfoToken_description(uint32_t i, IInfoToken *p_userda
 }
 
 Error GDRESettings::load_import_files() {
-	Vector<String> resource_files;
+	Vector<Ref<PackedFileInfo>> resource_files;
+	uint64_t start_time = OS::get_singleton()->get_ticks_msec();
 	ERR_FAIL_COND_V_MSG(!is_pack_loaded(), ERR_DOES_NOT_EXIST, "pack/dir not loaded!");
 	static const Vector<String> v3wildcards = {
 		"*.import",
@@ -2183,22 +2279,42 @@ Error GDRESettings::load_import_files() {
 		}
 		v2wildcards.push_back("*.gde");
 		v2wildcards.push_back("*.gdc");
-		resource_files = get_file_list(v2wildcards);
+		resource_files = get_file_info_list(v2wildcards);
 	} else if (_ver_major == 3 || _ver_major == 4) {
-		resource_files = get_file_list(v3wildcards);
+		resource_files = get_file_info_list(v3wildcards);
 	} else {
 		ERR_FAIL_V_MSG(ERR_BUG, "Can't determine major version!");
 	}
-	Vector<IInfoToken> tokens;
-	for (int i = 0; i < resource_files.size(); i++) {
-		tokens.push_back({ resource_files[i], nullptr, (int)get_ver_major(), (int)get_ver_minor() });
-	}
 
-	if (tokens.size() == 0) {
+	if (resource_files.size() == 0) {
 		print_line("No import files found!");
 		return OK;
 	}
 
+	// Order by pack and offset so that the header reads from the workers are (mostly) sequential within each pack
+	struct PackOrderComparator {
+		bool operator()(const Ref<PackedFileInfo> &a, const Ref<PackedFileInfo> &b) const {
+			if (a->get_pack() != b->get_pack()) {
+				return a->get_pack() < b->get_pack();
+			}
+			return a->get_offset() < b->get_offset();
+		}
+	};
+	resource_files.sort_custom<PackOrderComparator>();
+
+	Vector<IInfoToken> tokens;
+	tokens.resize(resource_files.size());
+	{
+		IInfoToken *tokens_ptr = tokens.ptrw();
+		int ver_major = get_ver_major();
+		int ver_minor = get_ver_minor();
+		for (int i = 0; i < resource_files.size(); i++) {
+			tokens_ptr[i] = { resource_files[i]->get_path(), nullptr, ver_major, ver_minor };
+		}
+	}
+	resource_files.clear();
+	uint64_t list_time = OS::get_singleton()->get_ticks_msec();
+
 	Error err = TaskManager::get_singleton()->run_multithreaded_group_task(
 			this,
 			&GDRESettings::_do_import_load,
@@ -2212,6 +2328,9 @@ Error GDRESettings::load_import_files() {
 	if (err != OK) {
 		WARN_PRINT("Failed to load import files!");
 	}
+	uint64_t load_time = OS::get_singleton()->get_ticks_msec();
+	int64_t import_files_idx = import_files.size();
+	import_files.resize(import_files_idx + tokens.size());
 	for (int i = 0; i < tokens.size(); i++) {
 		if (tokens[i].info.is_null()) {
 #ifdef DEBUG_ENABLED
@@ -2231,8 +2350,11 @@ Error GDRESettings::load_import_files() {
 				remap_iinfo.insert(tokens[i].path, tokens[i].info);
 			}
 		}
-		import_files.push_back(tokens[i].info);
+		import_files[import_files_idx++] = tokens[i].info;
 	}
+	import_files.resize(import_files_idx);
+	uint64_t end_time = OS::get_singleton()->get_ticks_msec();
+	print_verbose(vformat("Loaded %d import files in %dms (listing: %dms, loading: %dms, collecting: %dms)", tokens.size(), end_time - start_time, list_time - start_time, load_time - list_time, end_time - load_time));
 	return OK;
 }
 
@@ -2414,6 +2536,16 @@ void GDRESettings::_do_string_load(uint32_t i, StringLoadToken *tokens) {
 		// avoid spamming the console with errors for empty files
 		GDRELogger::get_thread_errors(); // clear errors if any
 		GDRELogger::set_thread_local_silent_errors(true);
+		if (ResourceFormatLoaderCompatBinary::is_binary_resource(tokens[i].path)) {
+			// fast path: pull the strings out of the property stream without instantiating anything
+			Vector<String> strings;
+			if (gdre::get_strings_from_binary_resource(tokens[i].path, strings, tokens[i].engine_version) == OK) {
+				GDRELogger::set_thread_local_silent_errors(false);
+				tokens[i].strings.append_array(strings);
+				return;
+			}
+			GDRELogger::get_thread_errors();
+		}
 		auto res = ResourceCompatLoader::fake_load(tokens[i].path, "", &tokens[i].err);
 		GDRELogger::set_thread_local_silent_errors(false);
 		if (res.is_null()) {
@@ -2519,6 +2651,204 @@ String GDRESettings::get_string_load_token_description(uint32_t i, StringLoadTok
 	return p_userdata[i].path;
 }
 
+void GDRESettings::_do_string_load_to_set(uint32_t i, StringLoadToken *tokens) {
+	auto &token = tokens[i];
+	_do_string_load(i, tokens);
+	if (token.err != OK) {
+		print_verbose("Failed to load resource strings for " + token.path);
+	} else if (!token.strings.is_empty()) {
+		StringSetPtr set = get_or_create_thread_value(thread_string_sets, []() {
+			return std::make_shared<HashSet<String>>();
+		});
+		// Strings repeated across resources collapse into a single copy here
+		for (const String &str : token.strings) {
+			set->insert(str);
+		}
+	}
+	token.strings.clear();
+}
+
+void GDRESettings::_do_string_set_merge(uint32_t i, StringSetMergeToken *tokens) {
+	auto &token = tokens[i];
+	// always insert the smaller set into the larger one
+	if (token.dst->size() < token.src->size()) {
+		std::swap(token.dst, token.src);
+	}
+	for (const String &str : *token.src) {
+		token.dst->insert(str);
+	}
+	token.src->clear();
+	token.src = nullptr;
+}
+
+String GDRESettings::get_string_set_merge_description(uint32_t i, StringSetMergeToken *p_userdata) {
+	return "Merging resource strings...";
+}
+
+String GDRESettings::_get_packs_cache_key() const {
+	if (packs.is_empty()) {
+		return "";
+	}
+	String key;
+	for (const auto &pack : packs) {
+		// Directories can change without their modification time changing
+		if (pack->type == PackInfo::DIR || !gdre::is_fs_path(pack->pack_file)) {
+			return "";
+		}
+		Ref<FileAccess> f = FileAccess::open(pack->pack_file, FileAccess::READ);
+		if (f.is_null()) {
+			return "";
+		}
+		key += "|" + pack->pack_file + "|" + itos(f->get_length()) + "|" + itos(FileAccess::get_modified_time(pack->pack_file));
+	}
+	return key;
+}
+
+namespace {
+constexpr int MAX_VERSION_CACHE_FILES = 256;
+constexpr int MAX_RESOURCE_STRINGS_CACHE_FILES = 16;
+constexpr int64_t MAX_RESOURCE_STRINGS_CACHE_SIZE = 256LL * 1024 * 1024;
+
+// Cache files are written to a temporary file and renamed into place, so an interrupted run never leaves a truncated cache behind.
+Error _open_cache_file(const String &p_path, Ref<FileAccess> &r_file) {
+	Error err = gdre::ensure_dir(p_path.get_base_dir());
+	ERR_FAIL_COND_V_MSG(err != OK, err, "Failed to create cache directory " + p_path.get_base_dir());
+	r_file = FileAccess::open(p_path + ".tmp", FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(r_file.is_null(), err, "Failed to open cache file " + p_path + ".tmp");
+	return OK;
+}
+
+Error _commit_cache_file(const String &p_path, Ref<FileAccess> &p_file, bool p_write_ok) {
+	String temp_path = p_path + ".tmp";
+	p_file->flush();
+	p_write_ok = p_write_ok && p_file->get_error() == OK;
+	p_file = Ref<FileAccess>();
+	Ref<DirAccess> da = DirAccess::create(DirAccess::ACCESS_FILESYSTEM);
+	if (!p_write_ok) {
+		da->remove(temp_path);
+		ERR_FAIL_V_MSG(ERR_FILE_CANT_WRITE, "Failed to write cache file " + p_path);
+	}
+	Error err = da->rename(temp_path, p_path);
+	if (err != OK) {
+		da->remove(temp_path);
+		ERR_FAIL_V_MSG(err, "Failed to move cache file into place: " + p_path);
+	}
+	return OK;
+}
+
+// Removes the oldest files in the cache directory until there are at most p_max_files of them, taking up at most p_max_size bytes (-1 for no limit).
+void _prune_cache_dir(const String &p_dir, int p_max_files, int64_t p_max_size = -1) {
+	Vector<String> files = gdre::get_files_at(p_dir, {});
+	files.sort_custom<FileModifiedTimeSorter>();
+	int64_t total_size = 0;
+	for (const String &file : files) {
+		total_size += FileAccess::get_size(file);
+	}
+	Ref<DirAccess> da = DirAccess::create(DirAccess::ACCESS_FILESYSTEM);
+	for (int i = 0; i < files.size(); i++) {
+		bool over_size = p_max_size >= 0 && total_size > p_max_size;
+		if (files.size() - i <= p_max_files && !over_size) {
+			break;
+		}
+		total_size -= FileAccess::get_size(files[i]);
+		da->remove(files[i]);
+	}
+}
+} //namespace
+
+String GDRESettings::get_resource_strings_cache_path() const {
+	String packs_key = _get_packs_cache_key();
+	if (packs_key.is_empty()) {
+		return "";
+	}
+	String key = get_gdre_version() + "|" + itos(get_bytecode_revision()) + "|" + itos(error_encryption) + "|" + (has_loaded_dotnet_assembly() ? get_dotnet_assembly_path() : "") + packs_key;
+	return get_gdre_user_path().path_join("resource_strings_cache").path_join(key.md5_text() + ".stringdump");
+}
+
+String GDRESettings::get_version_cache_path() const {
+	String packs_key = _get_packs_cache_key();
+	if (packs_key.is_empty()) {
+		return "";
+	}
+	// custom/forced bytecode settings change what revision gets detected
+	String key = get_gdre_version() + "|" + String(GDREConfig::get_singleton()->get_setting("Bytecode/load_custom_bytecode", "")) + "|" + itos(GDREConfig::get_singleton()->get_setting("Bytecode/force_bytecode_revision", 0)) + packs_key;
+	return get_gdre_user_path().path_join("version_cache").path_join(key.md5_text() + ".json");
+}
+
+bool GDRESettings::load_version_cache(const String &p_path, bool p_load_version) {
+	Error err = OK;
+	String text = FileAccess::get_file_as_string(p_path, &err);
+	if (err != OK) {
+		return false;
+	}
+	Dictionary dict = JSON::parse_string(text);
+	if (dict.is_empty()) {
+		return false;
+	}
+	Ref<GodotVer> version;
+	if (p_load_version) {
+		version = GodotVer::parse(dict.get("version", ""));
+		if (version.is_null() || !version->is_valid_semver()) {
+			return false;
+		}
+	}
+	int64_t bytecode_revision = dict.get("bytecode_revision", 0);
+	if (version.is_valid()) {
+		current_project->version = version;
+		current_project->suspect_version = false;
+	}
+	if (current_project->bytecode_revision == 0) {
+		current_project->bytecode_revision = bytecode_revision;
+	}
+	return true;
+}
+
+Error GDRESettings::save_version_cache(const String &p_path, bool p_save_version) {
+	Dictionary dict;
+	if (p_save_version) {
+		dict["version"] = get_version_string();
+	}
+	dict["bytecode_revision"] = get_bytecode_revision();
+	Ref<FileAccess> f;
+	Error err = _open_cache_file(p_path, f);
+	if (err != OK) {
+		return err;
+	}
+	bool write_ok = f->store_string(JSON::stringify(dict));
+	err = _commit_cache_file(p_path, f, write_ok);
+	_prune_cache_dir(p_path.get_base_dir(), MAX_VERSION_CACHE_FILES);
+	return err;
+}
+
+Error GDRESettings::load_resource_strings_cache(const String &p_path, HashSet<String> &r_strings) {
+	Error err = OK;
+	String text = FileAccess::get_file_as_string(p_path, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, err, "Failed to open resource strings cache " + p_path);
+	// Lines are seperated by the bell character followed by a newline
+	for (const String &line : text.split("\b\n", false)) {
+		r_strings.insert(line);
+	}
+	return OK;
+}
+
+Error GDRESettings::save_resource_strings_cache(const String &p_path, const HashSet<String> &p_strings) {
+	Ref<FileAccess> f;
+	Error err = _open_cache_file(p_path, f);
+	if (err != OK) {
+		return err;
+	}
+	bool write_ok = true;
+	for (const String &str : p_strings) {
+		if (!f->store_string(str + "\b\n")) {
+			write_ok = false;
+			break;
+		}
+	}
+	err = _commit_cache_file(p_path, f, write_ok);
+	_prune_cache_dir(p_path.get_base_dir(), MAX_RESOURCE_STRINGS_CACHE_FILES, MAX_RESOURCE_STRINGS_CACHE_SIZE);
+	return err;
+}
+
 void GDRESettings::load_all_resource_strings() {
 	if (!is_pack_loaded()) {
 		return;
@@ -2531,6 +2861,14 @@ void GDRESettings::load_all_resource_strings() {
 		print_line("Skipping loading resource strings from all resources");
 		return;
 	}
+	String cache_path = GDREConfig::get_singleton()->get_setting("Exporter/Translation/cache_resource_strings", true) ? get_resource_strings_cache_path() : "";
+	if (!cache_path.is_empty() && FileAccess::exists(cache_path)) {
+		if (load_resource_strings_cache(cache_path, current_project->resource_strings) == OK) {
+			print_verbose("Loaded resource strings from cache");
+			current_project->loaded_resource_strings = true;
+			return;
+		}
+	}
 	List<String> extensions;
 	ResourceCompatLoader::get_base_extensions(&extensions, get_ver_major());
 	Vector<String> wildcards;
@@ -2575,9 +2913,10 @@ void GDRESettings::load_all_resource_strings() {
 		tokens.write[i].engine_version = engine_ver;
 	}
 	print_line("Loading resource strings, this may take a while!!");
+	thread_string_sets.clear();
 	Error err = TaskManager::get_singleton()->run_multithreaded_group_task(
 			this,
-			&GDRESettings::_do_string_load,
+			&GDRESettings::_do_string_load_to_set,
 			tokens.ptrw(),
 			tokens.size(),
 			&GDRESettings::get_string_load_token_description,
@@ -2585,14 +2924,44 @@ void GDRESettings::load_all_resource_strings() {
 	if (err != OK) {
 		WARN_PRINT("Failed to load resource strings!");
 	}
+	tokens.clear();
+	gdre::clear_script_strings_cache();
+
+	// Pairwise reduction of the per-thread sets
+	Vector<StringSetPtr> sets;
+	thread_string_sets.for_each([&](const auto &v) {
+		sets.push_back(v.second);
+	});
+	thread_string_sets.clear();
+	while (sets.size() > 1) {
+		int stride = (sets.size() + 1) / 2;
+		Vector<StringSetMergeToken> merge_tokens;
+		merge_tokens.resize(sets.size() - stride);
+		for (int i = 0; i < merge_tokens.size(); i++) {
+			merge_tokens.write[i] = { sets[i], sets[i + stride] };
+		}
+		TaskManager::get_singleton()->run_multithreaded_group_task(
+				this,
+				&GDRESettings::_do_string_set_merge,
+				merge_tokens.ptrw(),
+				merge_tokens.size(),
+				&GDRESettings::get_string_set_merge_description,
+				"GDRESettings::load_all_resource_strings::merge", RTR("Merging resource strings..."),
+				false, -1, true, nullptr, 0, false);
+		sets.resize(stride);
+		for (int i = 0; i < merge_tokens.size(); i++) {
+			sets.write[i] = merge_tokens[i].dst;
+		}
+	}
 	print_line("Resource strings loaded!");
-	for (int i = 0; i < tokens.size(); i++) {
-		if (tokens[i].err != OK) {
-			print_verbose("Failed to load resource strings for " + tokens[i].path);
-			continue;
+	if (sets.size() == 1) {
+		if (err == OK && !cache_path.is_empty()) {
+			save_resource_strings_cache(cache_path, *sets[0]);
 		}
-		for (auto &str : tokens[i].strings) {
-			current_project->resource_strings.insert(str);
+		if (current_project->resource_strings.is_empty()) {
+			current_project->resource_strings = *sets[0];
+		} else {
+			gdre::hashset_insert_iterable(current_project->resource_strings, *sets[0]);
 		}
 	}
 	current_project->loaded_resource_strings = true;
@@ -2855,6 +3224,7 @@ void GDRESettings::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("had_encryption_error"), &GDRESettings::had_encryption_error);
 	ClassDB::bind_method(D_METHOD("get_file_list", "filters"), &GDRESettings::get_file_list, DEFVAL(Vector<String>()));
 	ClassDB::bind_method(D_METHOD("get_file_info_array", "filters"), &GDRESettings::get_file_info_array, DEFVAL(Vector<String>()));
+	ClassDB::bind_method(D_METHOD("for_each_file", "callback", "filters", "sorted"), &GDRESettings::for_each_file, DEFVAL(Vector<String>()), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("get_pack_type"), &GDRESettings::get_pack_type);
 	ClassDB::bind_method(D_METHOD("get_pack_path"), &GDRESettings::get_pack_path);
 	ClassDB::bind_method(D_METHOD("get_pack_info_list"), &GDRESettings::get_pack_info_list);
@@ -9,8 +9,11 @@
 
 #include "core/config/project_settings.h"
 #include "core/object/object.h"
+#include "core/os/thread.h"
 #include "core/os/thread_safe.h"
 
+#include <memory>
+
 class GDRELogger;
 class GDREPackedData;
 class GodotMonoDecompWrapper;
@@ -150,12 +153,35 @@ private:
 		Error err = OK;
 	};
 
+	typedef std::shared_ptr<HashSet<String>> StringSetPtr;
+	struct StringSetMergeToken {
+		StringSetPtr dst;
+		StringSetPtr src;
+	};
+
 	// Load import file task function
 	void _do_import_load(uint32_t i, IInfoToken *tokens);
 	String get_IInfoToken_description(uint32_t i, IInfoToken *p_userdata);
 	// String load individual file task function
 	void _do_string_load(uint32_t i, StringLoadToken *tokens);
 	String get_string_load_token_description(uint32_t i, StringLoadToken *p_userdata);
+	// Same as `_do_string_load`, but moves the strings into the calling thread's string set
+	void _do_string_load_to_set(uint32_t i, StringLoadToken *tokens);
+	// Merges two per-thread string sets (reduction step)
+	void _do_string_set_merge(uint32_t i, StringSetMergeToken *tokens);
+	String get_string_set_merge_description(uint32_t i, StringSetMergeToken *p_userdata);
+	// Per-thread string sets used while loading resource strings
+	ParallelFlatHashMap<Thread::ID, StringSetPtr> thread_string_sets;
+	// Returns a key identifying the currently loaded pack files, or an empty string if they can't be cached
+	String _get_packs_cache_key() const;
+	// Returns the path to the resource strings cache file for the currently loaded packs, or an empty string if they can't be cached
+	String get_resource_strings_cache_path() const;
+	// Returns the path to the detected version/bytecode revision cache file for the currently loaded packs, or an empty string if they can't be cached
+	String get_version_cache_path() const;
+	bool load_version_cache(const String &p_path, bool p_load_version);
+	Error save_version_cache(const String &p_path, bool p_save_version);
+	Error load_resource_strings_cache(const String &p_path, HashSet<String> &r_strings);
+	Error save_resource_strings_cache(const String &p_path, const HashSet<String> &p_strings);
 	HashMap<ResourceUID::ID, UID_Cache> unique_ids; //unique IDs and utf8 paths (less memory used)
 	ParallelFlatHashMap<String, ResourceUID::ID> path_to_uid;
 	HashMap<String, Dictionary> script_cache;
@@ -314,6 +340,9 @@ public:
 	Array get_file_info_array(const Vector<String> &filters = Vector<String>());
 	// Returns the list of file infos in the project, filtered by the given filters
 	Vector<Ref<PackedFileInfo>> get_file_info_list(const Vector<String> &filters = Vector<String>());
+	// Calls the callback with the path of each file in the project, filtered by the given filters, without building a list
+	// Iteration stops if the callback returns false; returns the number of files visited
+	int64_t for_each_file(const Callable &p_callback, const Vector<String> &filters = Vector<String>(), bool p_sorted = false);
 	// Returns the list of currently loaded packs
 	TypedArray<PackInfo> get_pack_info_list() const;
 	// Returns the list of paths to the currently loaded packs
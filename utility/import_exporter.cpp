@@ -3,6 +3,7 @@
 
 #include "bytecode/bytecode_base.h"
 #include "compat/oggstr_loader_compat.h"
+#include "compat/resource_cache_compat.h"
 #include "compat/resource_loader_compat.h"
 #include "core/error/error_list.h"
 #include "core/error/error_macros.h"
@@ -467,6 +468,30 @@ void ImportExporter::update_exts() {
 	}
 }
 
+// Reads the resource info and dependencies of the exported resource in a single pass
+void ImportExporter::_capture_resource_info(const Ref<ExportReport> &p_report) {
+	auto iinfo = p_report->get_import_info();
+	auto path = iinfo->get_path();
+	List<String> deps;
+	Ref<ResourceInfo> res_info;
+	// exporters that already needed the dependencies (e.g. the scene scheduler) have filled them in
+	bool have_deps = !p_report->dependencies.is_empty();
+	if (ResourceCompatLoader::handles_resource(path)) {
+		if (have_deps) {
+			res_info = ResourceCompatLoader::get_resource_info(path);
+		} else {
+			res_info = ResourceCompatLoader::get_resource_info_and_dependencies(path, &deps, false);
+		}
+	} else if (!have_deps) {
+		ResourceCompatLoader::get_dependencies(path, &deps, false);
+	}
+	p_report->actual_type = res_info.is_valid() ? res_info->type : iinfo->get_type();
+	p_report->script_class = res_info.is_valid() ? res_info->script_class : "";
+	for (auto &dep : deps) {
+		p_report->dependencies.push_back(dep);
+	}
+}
+
 void ImportExporter::rewrite_metadata(ExportToken &token) {
 	auto &token_report = token.report;
 	ERR_FAIL_COND_MSG(token_report.is_null(), "Cannot rewrite metadata for null report");
@@ -486,19 +511,7 @@ void ImportExporter::rewrite_metadata(ExportToken &token) {
 	}
 	if (!iinfo->is_import()) {
 		if (iinfo->get_ver_major() >= 4) {
-			List<String> deps;
-			auto path = iinfo->get_path();
-			if (ResourceCompatLoader::handles_resource(path)) {
-				auto res_info = ResourceCompatLoader::get_resource_info(path);
-				token_report->actual_type = res_info.is_valid() ? res_info->type : iinfo->get_type();
-				token_report->script_class = res_info.is_valid() ? res_info->script_class : "";
-			} else {
-				token_report->actual_type = iinfo->get_type();
-			}
-			ResourceCompatLoader::get_dependencies(path, &deps, false);
-			for (auto &dep : deps) {
-				token_report->dependencies.push_back(dep);
-			}
+			_capture_resource_info(token_report);
 			token_report->import_md5 = "";
 			token_report->import_modified_time = 0;
 			token_report->modified_time = FileAccess::get_modified_time(token_report->get_saved_path());
@@ -559,21 +572,12 @@ void ImportExporter::rewrite_metadata(ExportToken &token) {
 		}
 	}
 	if (!err && iinfo->get_ver_major() >= 4 && export_matches_source && token_report->get_rewrote_metadata() != ExportReport::NOT_IMPORTABLE) {
-		String resource_script_class;
-		List<String> deps;
-		auto path = iinfo->get_path();
-		if (ResourceCompatLoader::handles_resource(path)) {
-			auto res_info = ResourceCompatLoader::get_resource_info(path);
-			token_report->actual_type = res_info.is_valid() ? res_info->type : iinfo->get_type();
-			token_report->script_class = res_info.is_valid() ? res_info->script_class : "";
-		} else {
-			token_report->actual_type = iinfo->get_type();
+		_capture_resource_info(token_report);
+		// if we just wrote the .import file, we already know its md5
+		token_report->import_md5 = iinfo->get_saved_md5(new_md_path);
+		if (token_report->import_md5.is_empty()) {
+			token_report->import_md5 = FileAccess::get_md5(new_md_path);
 		}
-		ResourceCompatLoader::get_dependencies(path, &deps, false);
-		for (auto &dep : deps) {
-			token_report->dependencies.push_back(dep);
-		}
-		token_report->import_md5 = FileAccess::get_md5(new_md_path);
 		token_report->import_modified_time = FileAccess::get_modified_time(new_md_path);
 		token_report->modified_time = FileAccess::get_modified_time(token_report->get_saved_path());
 	}
@@ -716,6 +720,24 @@ void ImportExporter::_do_export(uint32_t i, ExportToken *tokens) {
 	}
 }
 
+Ref<GDScriptDecomp> ImportExporter::get_thread_script_decomp() {
+	return get_or_create_thread_value(script_decomps, [&]() {
+		return GDScriptDecomp::create_decomp_for_commit(script_decomp_revision);
+	});
+}
+
+void ImportExporter::_do_script_export(uint32_t i, ExportToken *tokens) {
+	auto &token = tokens[i];
+	token.report = ResourceExporter::_check_for_existing_resources(token.iinfo);
+	if (token.report.is_valid()) {
+		return;
+	}
+	// Each worker thread keeps its own decompiler instance for the whole stage
+	token.report = gdscript_exporter->export_script(output_dir, token.iinfo, get_thread_script_decomp());
+	rewrite_metadata(token);
+	token.report->append_error_messages(GDRELogger::get_thread_errors());
+}
+
 String ImportExporter::get_export_token_description(uint32_t i, ExportToken *tokens) {
 	return tokens[i].iinfo.is_valid() ? tokens[i].iinfo->get_path() : "";
 }
@@ -766,18 +788,90 @@ Error ImportExporter::_reexport_translations(Vector<ImportExporter::ExportToken>
 	return err;
 }
 
-void ImportExporter::recreate_uid_file(const String &src_path, bool is_import, const HashSet<String> &files_to_export_set) {
-	auto uid = GDRESettings::get_singleton()->get_uid_for_path(src_path);
-	if (uid != ResourceUID::INVALID_ID) {
-		String output_file = output_dir.path_join(src_path.trim_prefix("res://"));
-		String uid_path = output_file + ".uid";
-		if ((is_import || files_to_export_set.has(src_path)) && FileAccess::exists(output_file)) {
-			Ref<FileAccess> f = FileAccess::open(uid_path, FileAccess::WRITE);
-			if (f.is_valid()) {
-				f->store_string(ResourceUID::get_singleton()->id_to_text(uid) + "\n");
-			}
+void ImportExporter::_write_uid_file(uint32_t i, UidFileEntry *entries) {
+	UidFileEntry &entry = entries[i];
+	if (!entry.output_exists && !FileAccess::exists(entry.output_file)) {
+		return;
+	}
+	Ref<FileAccess> f = FileAccess::open(entry.output_file + ".uid", FileAccess::WRITE);
+	if (f.is_valid()) {
+		f->store_string(entry.uid_text);
+		entry.written = true;
+	}
+}
+
+String ImportExporter::get_uid_file_description(uint32_t i, UidFileEntry *entries) {
+	return entries[i].output_file + ".uid";
+}
+
+// 4.4 and higher have .uid files for resources without .import files (scripts, shaders, etc.) that we have to recreate
+void ImportExporter::recreate_uid_files(const Vector<String> &exported_scripts, const HashSet<String> &files_to_export_set) {
+	static const Vector<String> non_custom_uid_filters = {
+		"*.image",
+		"*.gdextension",
+		"*.gd",
+		// "*.gdc", -- these show up outside of res://.godot, so we don't want to recreate them
+		"*.ctex",
+		"*.ctexarray",
+		"*.ccube",
+		"*.ccubearray",
+		"*.ctex3d",
+		"*.shader",
+		"*.gdshader",
+		"*.gdshaderinc",
+		"*.dds",
+		"*.ktx",
+		"*.ktx2",
+		"*.ogv",
+		"*.cs"
+	};
+	// Build the path -> uid index once up front; the uid cache lookups are cheap, the file writes are not.
+	HashSet<String> seen;
+	Vector<UidFileEntry> entries;
+	auto add_entry = [&](const String &src_path, bool output_exists) {
+		if (seen.has(src_path)) {
+			return;
 		}
+		seen.insert(src_path);
+		auto uid = get_settings()->get_uid_for_path(src_path);
+		if (uid == ResourceUID::INVALID_ID) {
+			return;
+		}
+		UidFileEntry entry;
+		entry.output_file = output_dir.path_join(src_path.trim_prefix("res://"));
+		entry.uid_text = ResourceUID::get_singleton()->id_to_text(uid) + "\n";
+		entry.output_exists = output_exists;
+		entries.push_back(entry);
+	};
+	// decompiled scripts were just written by the exporter
+	for (const String &script : exported_scripts) {
+		add_entry(script, true);
+	}
+	auto non_custom_uid_files = get_settings()->get_file_list(non_custom_uid_filters);
+	for (const String &file : non_custom_uid_files) {
+		// any hidden directory
+		if (file.begins_with("res://.") || !files_to_export_set.has(file)) {
+			continue;
+		}
+		add_entry(file, false);
 	}
+	if (entries.is_empty()) {
+		return;
+	}
+	TaskManager::get_singleton()->run_multithreaded_group_task(
+			this,
+			&ImportExporter::_write_uid_file,
+			entries.ptrw(),
+			entries.size(),
+			&ImportExporter::get_uid_file_description,
+			"ImportExporter::recreate_uid_files",
+			"Writing uid files...",
+			false, -1, true, nullptr, 0, false, true);
+	int64_t written = 0;
+	for (const UidFileEntry &entry : entries) {
+		written += entry.written ? 1 : 0;
+	}
+	print_verbose(vformat("Wrote %d uid files", written));
 }
 
 struct ProcessRunnerStruct : public TaskRunnerStruct {
@@ -899,6 +993,8 @@ Error ImportExporter::export_imports(const String &p_out_dir, const Vector<Strin
 
 	ResourceCompatLoader::make_globally_available();
 	ResourceCompatLoader::set_default_gltf_load(false);
+	ResourceCacheCompat::reset_stats();
+	ResourceCacheCompat::set_max_size((int64_t)GDREConfig::get_singleton()->get_setting("shared_resource_cache_size_mb", 256) * 1024 * 1024);
 
 	bool partial_export = (_files_to_export.size() > 0 && _files_to_export.size() != get_settings()->get_file_info_list({}).size());
 	size_t export_files_count = partial_export ? _files_to_export.size() : _files.size();
@@ -942,6 +1038,10 @@ Error ImportExporter::export_imports(const String &p_out_dir, const Vector<Strin
 		}
 		ResourceCompatLoader::unmake_globally_available();
 		ResourceCompatLoader::set_default_gltf_load(false);
+		Dictionary cache_stats = ResourceCacheCompat::get_stats();
+		print_verbose(vformat("Shared resource cache: %d hits, %d misses, %d evictions", cache_stats["hits"], cache_stats["misses"], cache_stats["evictions"]));
+		ResourceCacheCompat::set_max_size(0);
+		ResourceCacheCompat::clear();
 		check_process_done(cancelled);
 	};
 
@@ -1020,6 +1120,7 @@ Error ImportExporter::export_imports(const String &p_out_dir, const Vector<Strin
 	}
 	Vector<ExportToken> non_high_priority_tokens;
 	Vector<ExportToken> tokens;
+	Vector<ExportToken> script_tokens;
 	Vector<ExportToken> non_multithreaded_tokens;
 	Vector<Ref<ImportInfo>> scene_tokens;
 	HashMap<String, Vector<Ref<ImportInfo>>> export_dest_to_iinfo;
@@ -1103,6 +1204,9 @@ Error ImportExporter::export_imports(const String &p_out_dir, const Vector<Strin
 			} else {
 				non_multithreaded_tokens.insert(0, { iinfo, nullptr, supports_multithreading });
 			}
+		} else if (importer == "script_bytecode" && supports_multithreading) {
+			// Scripts get their own stage so that they don't compete with heavyweight assets
+			script_tokens.push_back({ iinfo, nullptr, supports_multithreading });
 		} else {
 			if (supports_multithreading) {
 				non_high_priority_tokens.push_back({ iinfo, nullptr, supports_multithreading });
@@ -1121,7 +1225,7 @@ Error ImportExporter::export_imports(const String &p_out_dir, const Vector<Strin
 	gdre::shuffle_vector(non_high_priority_tokens);
 	tokens.append_array(non_high_priority_tokens);
 
-	pr->set_progress_length(false, tokens.size() + non_multithreaded_tokens.size());
+	pr->set_progress_length(false, script_tokens.size() + tokens.size() + non_multithreaded_tokens.size());
 
 	HashMap<String, String> dupe_to_orig_src;
 	auto rewrite_dest = [&](const String &dest, const Ref<ImportInfo> &iinfo, bool is_autoconverted) {
@@ -1230,7 +1334,32 @@ Error ImportExporter::export_imports(const String &p_out_dir, const Vector<Strin
 		}
 	}
 
+	int64_t num_script_tokens = script_tokens.size();
 	int64_t num_multithreaded_tokens = tokens.size();
+	// ***** Decompile scripts *****
+	GDRELogger::clear_error_queues();
+	if (script_tokens.size() > 0) {
+		script_decomp_revision = get_settings()->get_bytecode_revision();
+		gdscript_exporter = Exporter::get_exporter("script_bytecode", "GDScript");
+		if (gdscript_exporter.is_null()) {
+			gdscript_exporter.instantiate();
+		}
+		err = TaskManager::get_singleton()->run_multithreaded_group_task(
+				this,
+				&ImportExporter::_do_script_export,
+				script_tokens.ptrw(),
+				script_tokens.size(),
+				&ImportExporter::get_export_token_description,
+				"ImportExporter::export_imports::scripts",
+				"Decompiling scripts...",
+				true, -1, true, pr, 0);
+		script_decomps.clear();
+		gdscript_exporter = nullptr;
+		if (err != OK) {
+			reset_before_return(true);
+			return err;
+		}
+	}
 	// ***** Export resources *****
 	GDRELogger::clear_error_queues();
 	if (tokens.size() > 0) {
@@ -1242,7 +1371,7 @@ Error ImportExporter::export_imports(const String &p_out_dir, const Vector<Strin
 				&ImportExporter::get_export_token_description,
 				"ImportExporter::export_imports",
 				"Exporting resources...",
-				true, -1, true, pr, 0);
+				true, -1, true, pr, num_script_tokens);
 		if (err != OK) {
 			reset_before_return(true);
 			return err;
@@ -1258,7 +1387,7 @@ Error ImportExporter::export_imports(const String &p_out_dir, const Vector<Strin
 				&ImportExporter::get_export_token_description,
 				"ImportExporter::export_imports",
 				"Exporting resources...",
-				true, pr, num_multithreaded_tokens);
+				true, pr, num_script_tokens + num_multithreaded_tokens);
 	}
 	if (err != OK) {
 		reset_before_return(true);
@@ -1284,6 +1413,7 @@ Error ImportExporter::export_imports(const String &p_out_dir, const Vector<Strin
 		return err;
 	}
 	tokens.append_array(non_multithreaded_tokens);
+	tokens.append_array(script_tokens);
 	pr->step("Finalizing...", tokens.size() - 1, false);
 	pr->set_progress_length(true);
 
@@ -1291,6 +1421,7 @@ Error ImportExporter::export_imports(const String &p_out_dir, const Vector<Strin
 	// add to report
 	bool has_remaps = GDRESettings::get_singleton()->has_any_remaps();
 	HashSet<String> success_paths;
+	Vector<String> exported_scripts;
 	bool doing_cache = get_ver_major() >= 4;
 	for (int i = 0; i < tokens.size(); i++) {
 		const ExportToken &token = tokens[i];
@@ -1360,7 +1491,10 @@ Error ImportExporter::export_imports(const String &p_out_dir, const Vector<Strin
 						auto path = output_dir.path_join(iinfo->get_import_md_path().trim_prefix("res://"));
 						iinfo->save_to(path);
 						ret->import_modified_time = FileAccess::get_modified_time(path);
-						ret->import_md5 = FileAccess::get_md5(path);
+						ret->import_md5 = iinfo->get_saved_md5(path);
+						if (ret->import_md5.is_empty()) {
+							ret->import_md5 = FileAccess::get_md5(path);
+						}
 						// we have to touch the md5 file again
 						auto md5_file_path = iinfo->get_md5_file_path();
 						touch_file(md5_file_path);
@@ -1374,7 +1508,7 @@ Error ImportExporter::export_imports(const String &p_out_dir, const Vector<Strin
 			report->decompiled_scripts.push_back(iinfo->get_path());
 			// 4.4 and higher have uid files for scripts that we have to recreate
 			if ((get_ver_major() == 4 && get_ver_minor() >= 4) || get_ver_major() > 4) {
-				recreate_uid_file(iinfo->get_source_file(), true, files_to_export_set);
+				exported_scripts.push_back(iinfo->get_source_file());
 			}
 		} else if (exporter == GDExtensionExporter::EXPORTER_NAME) {
 			if (!ret->get_message().is_empty()) {
@@ -1435,33 +1569,7 @@ Error ImportExporter::export_imports(const String &p_out_dir, const Vector<Strin
 	// Need to recreate the uid files for the exported resources
 	// check if we're at version 4.4 or higher
 	if ((get_ver_major() == 4 && get_ver_minor() >= 4) || get_ver_major() > 4) {
-		static const Vector<String> non_custom_uid_filters = {
-			"*.image",
-			"*.gdextension",
-			"*.gd",
-			// "*.gdc", -- these show up outside of res://.godot, so we don't want to recreate them
-			"*.ctex",
-			"*.ctexarray",
-			"*.ccube",
-			"*.ccubearray",
-			"*.ctex3d",
-			"*.shader",
-			"*.gdshader",
-			"*.gdshaderinc",
-			"*.dds",
-			"*.ktx",
-			"*.ktx2",
-			"*.ogv",
-			"*.cs"
-		};
-		auto non_custom_uid_files = get_settings()->get_file_list(non_custom_uid_filters);
-		for (int i = 0; i < non_custom_uid_files.size(); i++) {
-			// any hidden directory
-			if (non_custom_uid_files[i].begins_with("res://.")) {
-				continue;
-			}
-			recreate_uid_file(non_custom_uid_files[i], false, files_to_export_set);
-		}
+		recreate_uid_files(exported_scripts, files_to_export_set);
 	}
 
 	if (get_settings()->is_project_config_loaded()) { // some pcks do not have project configs
@@ -1522,7 +1630,7 @@ Error ImportExporter::export_imports(const String &p_out_dir, const Vector<Strin
 					&ImportExporter::get_file_info_description,
 					"ImportExporter::export_imports::filesystem_cache",
 					"Generating filesystem cache...",
-					true, -1, true);
+					true, -1, true, nullptr, 0, true, true);
 		} else {
 			HashSet<String> scan_set;
 			for (auto &E : files_to_export_set) {
@@ -1561,7 +1669,7 @@ Error ImportExporter::export_imports(const String &p_out_dir, const Vector<Strin
 					&ImportExporter::get_file_info_description,
 					"ImportExporter::export_imports::filesystem_cache",
 					"Generating filesystem cache...",
-					true, -1, true);
+					true, -1, true, nullptr, 0, true, true);
 			file_infos.sort_custom<FileInfoComparator>();
 		}
 		if (file_infos.size() > 0) {
@@ -1573,10 +1681,8 @@ Error ImportExporter::export_imports(const String &p_out_dir, const Vector<Strin
 	reset_before_return(false);
 	report->print_report();
 	if (GDREConfig::get_singleton()->get_setting("write_json_report", false)) {
-		String json_file = output_dir.path_join("gdre_export.json");
-		Ref<FileAccess> f = FileAccess::open(json_file, FileAccess::WRITE, &err);
-		ERR_FAIL_COND_V_MSG(err || f.is_null(), ERR_FILE_CANT_WRITE, "can't open report.json for writing");
-		f->store_string(JSON::stringify(report->to_json(), "\t", false, true));
+		err = report->save_json(output_dir.path_join("gdre_export.json"));
+		ERR_FAIL_COND_V_MSG(err, ERR_FILE_CANT_WRITE, "can't write report.json");
 	}
 	return OK;
 }
@@ -1971,7 +2077,7 @@ Dictionary ImportExporterReport::get_section_labels() {
 	return labels;
 }
 
-Dictionary ImportExporterReport::get_report_sections() {
+Dictionary ImportExporterReport::get_report_sections(bool p_include_success) {
 	Dictionary sections;
 	// sections["totals"] = get_totals();
 	// sections["unsupported_types"] = get_unsupported_types();
@@ -2064,9 +2170,11 @@ Dictionary ImportExporterReport::get_report_sections() {
 		}
 	}
 
-	sections["success"] = Dictionary();
-	Dictionary success_dict = sections["success"];
-	add_to_dict(success_dict, success);
+	if (p_include_success) {
+		sections["success"] = Dictionary();
+		Dictionary success_dict = sections["success"];
+		add_to_dict(success_dict, success);
+	}
 	sections["decompiled_scripts"] = Dictionary();
 	Dictionary decompiled_scripts_dict = sections["decompiled_scripts"];
 	for (int i = 0; i < decompiled_scripts.size(); i++) {
@@ -2370,14 +2478,23 @@ ImportExporterReport::ImportExporterReport(const String &p_ver, const String &p_
 	game_name = p_game_name;
 }
 
-Dictionary ImportExporterReport::to_json() const {
-	auto vec_to_json_array = [](const Vector<Ref<ExportReport>> &vec) -> Array {
-		Array arr;
-		for (auto &info : vec) {
-			arr.append(info->to_json());
-		}
-		return arr;
-	};
+TypedArray<Dictionary> ImportExporterReport::get_successes_page(int64_t p_offset, int64_t p_count) const {
+	TypedArray<Dictionary> page;
+	int64_t end = MIN(p_offset + p_count, (int64_t)success.size());
+	for (int64_t i = MAX(p_offset, (int64_t)0); i < end; i++) {
+		Dictionary entry;
+		entry["path"] = success[i]->get_path();
+		entry["new_source_path"] = success[i]->get_new_source_path();
+		page.push_back(entry);
+	}
+	return page;
+}
+
+int64_t ImportExporterReport::get_successes_count() const {
+	return success.size();
+}
+
+Dictionary ImportExporterReport::_get_json_header() const {
 	Dictionary json;
 
 	json["report_version"] = REPORT_VERSION;
@@ -2395,9 +2512,6 @@ Dictionary ImportExporterReport::to_json() const {
 	json["decompiled_scripts"] = decompiled_scripts;
 	json["failed_scripts"] = failed_scripts;
 	json["translation_export_message"] = translation_export_message;
-	json["failed"] = vec_to_json_array(failed);
-	json["success"] = vec_to_json_array(success);
-	json["not_converted"] = vec_to_json_array(not_converted);
 	json["failed_plugin_cfg_create"] = failed_plugin_cfg_create;
 	json["failed_gdnative_copy"] = failed_gdnative_copy;
 	json["unsupported_types"] = unsupported_types;
@@ -2405,6 +2519,45 @@ Dictionary ImportExporterReport::to_json() const {
 	return json;
 }
 
+Dictionary ImportExporterReport::to_json() const {
+	auto vec_to_json_array = [](const Vector<Ref<ExportReport>> &vec) -> Array {
+		Array arr;
+		for (auto &info : vec) {
+			arr.append(info->to_json());
+		}
+		return arr;
+	};
+	Dictionary json = _get_json_header();
+	json["failed"] = vec_to_json_array(failed);
+	json["success"] = vec_to_json_array(success);
+	json["not_converted"] = vec_to_json_array(not_converted);
+	return json;
+}
+
+Error ImportExporterReport::save_json(const String &p_path) const {
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(f.is_null(), err == OK ? ERR_FILE_CANT_WRITE : err, "can't open " + p_path + " for writing");
+	f->store_string("{\n");
+	Dictionary header = _get_json_header();
+	Array keys = header.keys();
+	for (int i = 0; i < keys.size(); i++) {
+		f->store_string("\t" + JSON::stringify(keys[i]) + ": " + JSON::stringify(header[keys[i]], "", false, true) + ",\n");
+	}
+	auto store_array = [&](const String &p_key, const Vector<Ref<ExportReport>> &p_vec, bool p_last) {
+		f->store_string("\t" + JSON::stringify(p_key) + ": [");
+		for (int64_t i = 0; i < p_vec.size(); i++) {
+			f->store_string(String(i == 0 ? "\n" : ",\n") + "\t\t" + JSON::stringify(p_vec[i]->to_json(), "", false, true));
+		}
+		f->store_string(String(p_vec.is_empty() ? "]" : "\n\t]") + (p_last ? "\n" : ",\n"));
+	};
+	store_array("failed", failed, false);
+	store_array("success", success, false);
+	store_array("not_converted", not_converted, true);
+	f->store_string("}\n");
+	return OK;
+}
+
 String ImportExporterReport::_to_string() {
 	return JSON::stringify(to_json(), "", false, true);
 }
@@ -2547,7 +2700,10 @@ void ImportExporterReport::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_failed_rewrite_md5"), &ImportExporterReport::get_failed_rewrite_md5);
 	ClassDB::bind_method(D_METHOD("get_failed_plugin_cfg_create"), &ImportExporterReport::get_failed_plugin_cfg_create);
 	ClassDB::bind_method(D_METHOD("get_failed_gdnative_copy"), &ImportExporterReport::get_failed_gdnative_copy);
-	ClassDB::bind_method(D_METHOD("get_report_sections"), &ImportExporterReport::get_report_sections);
+	ClassDB::bind_method(D_METHOD("get_report_sections", "include_success"), &ImportExporterReport::get_report_sections, DEFVAL(true));
+	ClassDB::bind_method(D_METHOD("get_successes_page", "offset", "count"), &ImportExporterReport::get_successes_page);
+	ClassDB::bind_method(D_METHOD("get_successes_count"), &ImportExporterReport::get_successes_count);
+	ClassDB::bind_method(D_METHOD("save_json", "path"), &ImportExporterReport::save_json);
 	ClassDB::bind_method(D_METHOD("get_section_labels"), &ImportExporterReport::get_section_labels);
 	ClassDB::bind_method(D_METHOD("print_report"), &ImportExporterReport::print_report);
 	ClassDB::bind_method(D_METHOD("set_ver", "ver"), &ImportExporterReport::set_ver);
@@ -2746,10 +2902,8 @@ Error ImportExporter::test_exported_project(const String &p_original_project_dir
 	}
 	rimraf_tmp_dir();
 	if (GDREConfig::get_singleton()->get_setting("write_json_report", false)) {
-		String json_file = output_dir.path_join("gdre_export.json");
-		Ref<FileAccess> f = FileAccess::open(json_file, FileAccess::WRITE);
-		ERR_FAIL_COND_V_MSG(f.is_null(), ERR_FILE_CANT_WRITE, "can't open report.json for writing");
-		f->store_string(JSON::stringify(report->to_json(), "\t", false, true));
+		Error err = report->save_json(output_dir.path_join("gdre_export.json"));
+		ERR_FAIL_COND_V_MSG(err, ERR_FILE_CANT_WRITE, "can't write report.json");
 	}
 	return _ret_err;
 }
@@ -3,15 +3,19 @@
 
 #include "compat/resource_import_metadatav2.h"
 #include "import_info.h"
+#include "utility/gd_parallel_hashmap.h"
 #include "utility/godotver.h"
 
 #include "core/object/object.h"
 #include "core/object/ref_counted.h"
+#include "core/os/thread.h"
 
 #include <memory>
 
 class ImportExporter;
 class ExportReport;
+class GDScriptDecomp;
+class GDScriptExporter;
 struct EditorProgressGDDC;
 class ImportExporterReport : public RefCounted {
 	GDCLASS(ImportExporterReport, RefCounted)
@@ -40,6 +44,8 @@ class ImportExporterReport : public RefCounted {
 	// TODO: add the rest of the options
 	bool opt_lossy = true;
 
+	Dictionary _get_json_header() const;
+
 public:
 	constexpr static const int REPORT_VERSION = 1;
 	void set_ver(String p_ver);
@@ -54,7 +60,7 @@ public:
 
 	Dictionary get_session_notes();
 	String get_totals_string();
-	Dictionary get_report_sections();
+	Dictionary get_report_sections(bool p_include_success = true);
 	String get_report_string();
 	String get_editor_message_string();
 	String get_detected_unsupported_resource_string();
@@ -79,6 +85,9 @@ public:
 	TypedArray<Dictionary> get_downloaded_plugins() const;
 	Vector<String> get_failed_plugin_cfg_create() const;
 	Vector<String> get_failed_gdnative_copy() const;
+	// the success section can be too large to build all at once, so the GUI pages through it
+	TypedArray<Dictionary> get_successes_page(int64_t p_offset, int64_t p_count) const;
+	int64_t get_successes_count() const;
 
 	bool is_steam_detected() const;
 	bool is_mono_detected() const;
@@ -89,6 +98,8 @@ public:
 	ImportExporterReport(const String &p_ver, const String &p_game_name);
 
 	Dictionary to_json() const;
+	// Writes the same content as to_json(), serializing the resource reports one at a time instead of building the whole tree
+	Error save_json(const String &p_path) const;
 	String _to_string() override;
 	static Ref<ImportExporterReport> from_json(const Dictionary &p_json);
 
@@ -118,6 +129,11 @@ class ImportExporter : public RefCounted {
 	HashSet<String> other_file_extensions;
 	HashSet<String> valid_extensions;
 
+	// per-thread decompilers for the script decompilation stage
+	ParallelFlatHashMap<Thread::ID, Ref<GDScriptDecomp>> script_decomps;
+	int script_decomp_revision = 0;
+	Ref<GDScriptExporter> gdscript_exporter;
+
 	// for the cache file
 	struct FileInfo {
 		String file;
@@ -151,15 +167,27 @@ class ImportExporter : public RefCounted {
 	void _do_file_info(uint32_t i, std::shared_ptr<FileInfo> *file_info);
 	String get_file_info_description(uint32_t i, std::shared_ptr<FileInfo> *file_info);
 	void _do_export(uint32_t i, ExportToken *tokens);
+	void _do_script_export(uint32_t i, ExportToken *tokens);
+	Ref<GDScriptDecomp> get_thread_script_decomp();
 	String get_export_token_description(uint32_t i, ExportToken *tokens);
 	Error handle_auto_converted_file(const String &autoconverted_file);
 	Error rewrite_import_source(const String &rel_dest_path, const Ref<ImportInfo> &iinfo);
 	void report_unsupported_resource(const String &type, const String &format_name, const String &importer, const String &import_path);
 	Error remove_remap_and_autoconverted(const String &src, const String &dst);
+	void _capture_resource_info(const Ref<ExportReport> &p_report);
 	void rewrite_metadata(ExportToken &token);
 	Error unzip_and_copy_addon(const Ref<ImportInfoGDExt> &iinfo, const String &zip_path, Vector<String> &output_dirs);
 	Error _reexport_translations(Vector<ExportToken> &non_multithreaded_tokens, size_t token_size, Ref<EditorProgressGDDC> pr);
-	void recreate_uid_file(const String &src_path, bool is_import, const HashSet<String> &files_to_export_set);
+	struct UidFileEntry {
+		String output_file;
+		String uid_text;
+		// if false, the output file came from the pack rather than an export and has to be checked on disk
+		bool output_exists = false;
+		bool written = false;
+	};
+	void _write_uid_file(uint32_t i, UidFileEntry *entries);
+	String get_uid_file_description(uint32_t i, UidFileEntry *entries);
+	void recreate_uid_files(const Vector<String> &exported_scripts, const HashSet<String> &files_to_export_set);
 	Error recreate_plugin_config(const String &plugin_cfg_path);
 	Error recreate_plugin_configs();
 
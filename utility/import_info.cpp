@@ -1047,6 +1047,8 @@ Error ImportInfoModern::save_to(const String &new_import_file) {
 	ERR_FAIL_COND_V_MSG(fa.is_null(), ERR_FILE_CANT_OPEN, "Failed to open file " + new_import_file);
 	fa->store_string(content);
 	fa->flush();
+	last_saved_path = new_import_file;
+	last_saved_md5 = content.md5_text();
 	return OK;
 }
 
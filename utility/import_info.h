@@ -89,6 +89,9 @@ protected:
 	bool not_an_import = false;
 	bool auto_converted_export = false;
 	bool dirty = false;
+	// path and md5 of the metadata content last written by save_to(), so callers don't need to re-read it
+	String last_saved_path;
+	String last_saved_md5;
 	String preferred_import_path;
 	String export_dest;
 	String export_lossless_copy;
@@ -178,6 +181,8 @@ public:
 	bool is_equal_to(const Ref<ImportInfo> &p_iinfo) const;
 
 	virtual Error save_to(const String &p_path) = 0;
+	// Returns the md5 of the content written by the last save_to() call to `p_path`, or an empty string if it wasn't saved there
+	String get_saved_md5(const String &p_path) const { return p_path == last_saved_path ? last_saved_md5 : String(); }
 	static Error get_resource_info(const String &p_path, Ref<ResourceInfo> &i_info);
 	static Ref<ImportInfo> copy(const Ref<ImportInfo> &p_iinfo);
 	static Ref<ImportInfo> load_from_file(const String &p_path, int ver_major = 0, int ver_minor = 0);
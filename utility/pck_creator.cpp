@@ -20,6 +20,8 @@ void PckCreator::reset() {
 	cancelled = false;
 	broken_cnt = 0;
 	data_read = 0;
+	dedup_count = 0;
+	dedup_bytes_saved = 0;
 }
 
 static const Vector<String> banned_files = { "thumbs.db", ".DS_Store" };
@@ -289,7 +291,7 @@ Error PckCreator::_add_files(
 	{
 		size_t i = 0;
 		for (auto &e : file_paths_to_pack) {
-			files_to_pck.write[i] = { e.value, e.key, 0, 0, encrypt, false, empty_md5 };
+			files_to_pck.write[i] = { e.value, e.key, 0, 0, encrypt, false, empty_md5, OK, -1 };
 			keys.write[i] = e.key;
 			i++;
 		}
@@ -329,21 +331,116 @@ Error PckCreator::_add_files(
 		print_error("At least one error was detected while adding files!\n" + error_string);
 		return err;
 	}
+	if (dedup) {
+		err = _find_duplicates();
+		if (err != OK) {
+			return err;
+		}
+	}
 	files_to_pck.resize(files_to_pck.size());
+	// where the payloads would end without deduplication, so the savings include the exact padding
+	uint64_t undeduped_offset = offset;
 	for (int64_t i = 0; i < files_to_pck.size(); i++) {
-		files_to_pck.write[i].ofs = offset;
 		uint64_t _size = files_to_pck[i].size;
 		if (encrypt) { // Add encryption overhead.
 			_size += get_encryption_padding(_size);
 		}
+		undeduped_offset += _size;
+		undeduped_offset += _get_pad(PCK_PADDING, undeduped_offset);
+		if (files_to_pck[i].dup_of != -1) {
+			// directory entry points at the original's payload, nothing gets written for it
+			files_to_pck.write[i].ofs = files_to_pck[files_to_pck[i].dup_of].ofs;
+			dedup_count++;
+			continue;
+		}
+		files_to_pck.write[i].ofs = offset;
 
 		offset += _size;
 		offset += _get_pad(PCK_PADDING, offset);
 	}
+	dedup_bytes_saved += undeduped_offset - offset;
+	if (dedup_count > 0) {
+		print_line("Deduplicated " + itos(dedup_count) + " files, saved " + String::humanize_size(dedup_bytes_saved));
+	}
 	bl_print("PCK folder processing took " + itos(OS::get_singleton()->get_ticks_msec() - start_time) + "ms");
 	return OK;
 }
 
+void PckCreator::_do_verify_duplicate(uint32_t i, DedupCandidate *tokens) {
+	if (unlikely(cancelled)) {
+		return;
+	}
+	auto &token = tokens[i];
+	token.same = false;
+	Ref<FileAccess> fa = FileAccess::open(files_to_pck[token.original].src_path, FileAccess::READ);
+	Ref<FileAccess> fb = FileAccess::open(files_to_pck[token.idx].src_path, FileAccess::READ);
+	if (fa.is_null() || fb.is_null()) {
+		return;
+	}
+	uint64_t rq_size = files_to_pck[token.idx].size;
+	if (fa->get_length() != rq_size || fb->get_length() != rq_size) {
+		return;
+	}
+	Vector<uint8_t> buf_a;
+	Vector<uint8_t> buf_b;
+	buf_a.resize(piecemeal_read_size);
+	buf_b.resize(piecemeal_read_size);
+	while (rq_size > 0) {
+		uint64_t to_read = MIN(piecemeal_read_size, rq_size);
+		uint64_t got_a = fa->get_buffer(buf_a.ptrw(), to_read);
+		uint64_t got_b = fb->get_buffer(buf_b.ptrw(), to_read);
+		if (got_a != to_read || got_b != to_read || memcmp(buf_a.ptr(), buf_b.ptr(), to_read) != 0) {
+			return;
+		}
+		rq_size -= to_read;
+	}
+	token.same = true;
+}
+
+String PckCreator::get_dedup_description(int64_t i, DedupCandidate *userdata) {
+	return files_to_pck[userdata[i].idx].src_path;
+}
+
+// Groups files by (size, md5) and verifies candidates byte-for-byte against the first file in the group.
+// Verified duplicates get `dup_of` set so that they share the original's payload in the PCK.
+Error PckCreator::_find_duplicates() {
+	HashMap<String, int64_t> originals;
+	Vector<DedupCandidate> candidates;
+	for (int64_t i = 0; i < files_to_pck.size(); i++) {
+		const File &file = files_to_pck[i];
+		if (file.size == 0 || file.removal) {
+			continue;
+		}
+		String content_key = itos(file.size) + ":" + String::hex_encode_buffer(file.md5.ptr(), file.md5.size());
+		auto *E = originals.getptr(content_key);
+		if (!E) {
+			originals[content_key] = i;
+			continue;
+		}
+		candidates.push_back({ i, *E, false });
+	}
+	if (candidates.is_empty()) {
+		return OK;
+	}
+	Error err = TaskManager::get_singleton()->run_multithreaded_group_task(
+			this,
+			&PckCreator::_do_verify_duplicate,
+			candidates.ptrw(),
+			candidates.size(),
+			&PckCreator::get_dedup_description,
+			"PckCreator::_find_duplicates",
+			"Checking for duplicate files...");
+	if (err == ERR_SKIP) {
+		return ERR_SKIP;
+	}
+	for (const auto &candidate : candidates) {
+		if (candidate.same) {
+			files_to_pck.write[candidate.idx].dup_of = candidate.original;
+		}
+	}
+	return OK;
+}
+
 Error PckCreator::read_and_write_file(size_t i, Ref<FileAccess> write_handle) {
 	Error error;
 	Ref<FileAccess> fa = FileAccess::open(files_to_pck[i].src_path, FileAccess::READ, &error);
@@ -377,6 +474,9 @@ void PckCreator::_do_write_file(uint32_t i, File *p_files_to_pck) {
 	if (encryption_error != OK) {
 		return;
 	}
+	if (p_files_to_pck[i].dup_of != -1) {
+		return;
+	}
 	DEV_ASSERT(f->get_position() == files_start + p_files_to_pck[i].ofs);
 	Ref<FileAccessEncrypted> fae;
 	Ref<FileAccess> ftmp = f;
@@ -770,6 +870,10 @@ void PckCreator::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_exe_to_embed"), &PckCreator::get_exe_to_embed);
 	ClassDB::bind_method(D_METHOD("set_watermark", "watermark"), &PckCreator::set_watermark);
 	ClassDB::bind_method(D_METHOD("get_watermark"), &PckCreator::get_watermark);
+	ClassDB::bind_method(D_METHOD("set_dedup", "dedup"), &PckCreator::set_dedup);
+	ClassDB::bind_method(D_METHOD("get_dedup"), &PckCreator::get_dedup);
+	ClassDB::bind_method(D_METHOD("get_dedup_count"), &PckCreator::get_dedup_count);
+	ClassDB::bind_method(D_METHOD("get_dedup_bytes_saved"), &PckCreator::get_dedup_bytes_saved);
 	ClassDB::bind_method(D_METHOD("get_error_message"), &PckCreator::get_error_message);
 
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "pack_version"), "set_pack_version", "get_pack_version");
@@ -780,5 +884,6 @@ void PckCreator::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "embed"), "set_embed", "get_embed");
 	ADD_PROPERTY(PropertyInfo(Variant::STRING, "exe_to_embed"), "set_exe_to_embed", "get_exe_to_embed");
 	ADD_PROPERTY(PropertyInfo(Variant::STRING, "watermark"), "set_watermark", "get_watermark");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "dedup"), "set_dedup", "get_dedup");
 	//ClassDB::bind_method(D_METHOD("get_dumped_files"), &PckCreator::get_dumped_files);
 }
@@ -19,6 +19,7 @@ class PckCreator : public RefCounted {
 	bool embed = false;
 	String exe_to_embed;
 	String watermark;
+	bool dedup = false;
 	struct File {
 		String path;
 		String src_path;
@@ -28,6 +29,13 @@ class PckCreator : public RefCounted {
 		bool removal = false;
 		Vector<uint8_t> md5;
 		Error err = OK;
+		int64_t dup_of = -1; // index of the file whose payload this entry shares
+	};
+
+	struct DedupCandidate {
+		int64_t idx = -1;
+		int64_t original = -1;
+		bool same = false;
 	};
 
 	Vector<File> files_to_pck;
@@ -36,6 +44,8 @@ class PckCreator : public RefCounted {
 	String error_string;
 	std::atomic<int64_t> broken_cnt = 0;
 	std::atomic<int64_t> data_read = 0;
+	int64_t dedup_count = 0;
+	uint64_t dedup_bytes_saved = 0;
 	Vector<String> tmp_files;
 	Ref<FileAccess> f;
 	size_t pck_start_pos = 0;
@@ -53,6 +63,9 @@ class PckCreator : public RefCounted {
 	String get_file_description(int64_t i, File *userdata);
 
 	void _do_write_file(uint32_t i, File *tokens);
+	void _do_verify_duplicate(uint32_t i, DedupCandidate *tokens);
+	String get_dedup_description(int64_t i, DedupCandidate *userdata);
+	Error _find_duplicates();
 
 	inline Error read_and_write_file(size_t i, Ref<FileAccess> write_handle);
 	Error headless_pck_create(const String &pck_path, const String &dir, const Vector<String> &include_filters, const Vector<String> &exclude_filters);
@@ -86,6 +99,10 @@ public:
 	String get_exe_to_embed() const { return exe_to_embed; }
 	void set_watermark(const String &wm) { watermark = wm; }
 	String get_watermark() const { return watermark; }
+	void set_dedup(bool p_dedup) { dedup = p_dedup; }
+	bool get_dedup() const { return dedup; }
+	int64_t get_dedup_count() const { return dedup_count; }
+	uint64_t get_dedup_bytes_saved() const { return dedup_bytes_saved; }
 	String get_error_message() const { return error_string; }
 };
 
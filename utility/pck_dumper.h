@@ -15,6 +15,11 @@ class PckDumper : public RefCounted {
 	std::atomic<int> completed_cnt = 0;
 	std::atomic<int> skipped_cnt = 0;
 	std::atomic<int> broken_cnt = 0;
+	// extraction throughput, time is summed across worker threads
+	std::atomic<uint64_t> encrypted_bytes = 0;
+	std::atomic<uint64_t> encrypted_usec = 0;
+	std::atomic<uint64_t> plain_bytes = 0;
+	std::atomic<uint64_t> plain_usec = 0;
 
 	bool _pck_file_check_md5(Ref<PackedFileInfo> &file);
 	void _do_md5_check(uint32_t i, Ref<PackedFileInfo> *tokens);
@@ -36,12 +36,38 @@ int TaskManager::get_max_thread_count() {
 	return WorkerThreadPool::get_singleton()->get_thread_count();
 }
 
+uint64_t TaskManager::get_progress_update_interval_usec() {
+	int64_t interval_ms = GDREConfig::get_singleton() ? (int64_t)GDREConfig::get_singleton()->get_setting("progress_update_interval_ms", 10) : 10;
+	return MAX(interval_ms, 1) * 1000;
+}
+
+void TaskManager::BaseTemplateTaskData::signal_done() {
+	{
+		std::lock_guard<std::mutex> lock(signal_mutex);
+		done_signaled = true;
+	}
+	signal_cv.notify_all();
+}
+
+void TaskManager::BaseTemplateTaskData::notify_waiter() {
+	{
+		std::lock_guard<std::mutex> lock(signal_mutex);
+	}
+	signal_cv.notify_all();
+}
+
+bool TaskManager::BaseTemplateTaskData::wait_for_signal(uint64_t p_timeout_usec) {
+	std::unique_lock<std::mutex> lock(signal_mutex);
+	return signal_cv.wait_for(lock, std::chrono::microseconds(p_timeout_usec), [&]() { return done_signaled.load(); });
+}
+
 void TaskManager::BaseTemplateTaskData::start() {
 	if (started) {
 		return;
 	}
 	start_internal();
 	started = true;
+	notify_waiter();
 }
 bool TaskManager::BaseTemplateTaskData::is_started() const {
 	return started;
@@ -52,6 +78,7 @@ bool TaskManager::BaseTemplateTaskData::is_canceled() const {
 void TaskManager::BaseTemplateTaskData::cancel() {
 	canceled = true;
 	cancel_internal();
+	notify_waiter();
 }
 void TaskManager::BaseTemplateTaskData::finish_progress() {
 	progress = nullptr;
@@ -89,7 +116,13 @@ String TaskManager::BaseTemplateTaskData::_get_task_description() {
 // returns true if the task was cancelled before completion
 bool TaskManager::BaseTemplateTaskData::update_progress(bool p_force_refresh) {
 	if (progress_enabled && progress.is_valid()) {
-		if (progress->step(_get_task_description(), get_current_task_step_value(), p_force_refresh)) {
+		// The waiting thread wakes up more often than the progress is redrawn. Forced updates still step it (on the main
+		// thread that's what keeps the main loop iterating), but the description is only formatted once per refresh interval.
+		bool refresh_due = progress->is_refresh_due();
+		if (refresh_due && EditorProgressGDDC::shows_state()) {
+			sampled_description = _get_task_description();
+		}
+		if ((refresh_due || p_force_refresh) && progress->step(sampled_description, get_current_task_step_value(), p_force_refresh)) {
 			if (!is_canceled()) {
 				cancel();
 			}
@@ -118,11 +151,14 @@ bool TaskManager::BaseTemplateTaskData::_wait_after_cancel() {
 
 	auto curr_time = OS::get_singleton()->get_ticks_msec();
 	constexpr uint64_t ABORT_THRESHOLD_MS = 10000;
-	while (!is_done() && OS::get_singleton()->get_ticks_msec() - curr_time < ABORT_THRESHOLD_MS) {
-		OS::get_singleton()->delay_usec(10000);
+	uint64_t update_interval_usec = get_progress_update_interval_usec();
+	while (!is_done() && !done_signaled && OS::get_singleton()->get_ticks_msec() - curr_time < ABORT_THRESHOLD_MS) {
+		if (wait_for_signal(update_interval_usec)) {
+			break;
+		}
 		wait_update_progress(is_main_thread);
 	}
-	if (is_done()) {
+	if (is_done() || done_signaled) {
 		wait_for_task_completion_internal();
 		return true;
 	} else {
@@ -145,8 +181,15 @@ bool TaskManager::BaseTemplateTaskData::wait_for_completion(uint64_t timeout_s_n
 		if (auto_start) {
 			start();
 		} else {
+			uint64_t update_interval_usec = get_progress_update_interval_usec();
 			while (!started && !is_canceled()) {
-				OS::get_singleton()->delay_usec(10000);
+				{
+					std::unique_lock<std::mutex> lock(signal_mutex);
+					signal_cv.wait_for(lock, std::chrono::microseconds(update_interval_usec), [&]() { return started || canceled; });
+				}
+				if (started || is_canceled()) {
+					break;
+				}
 				if (!dont_update_progress_bg) {
 					if (TaskManager::get_singleton()->update_progress_bg(is_main_thread)) {
 						break;
@@ -173,6 +216,8 @@ bool TaskManager::BaseTemplateTaskData::wait_for_completion(uint64_t timeout_s_n
 		auto last_progress = get_current_task_step_value();
 		bool printed_warning = false;
 		[[maybe_unused]] uint64_t last_reported_mem_usage_ms = 0;
+		// Sleep until the task signals completion; wake up periodically to refresh progress and check for cancellation/timeouts
+		uint64_t update_interval_usec = get_progress_update_interval_usec();
 		while (!is_done()) {
 #if 0
 			if (OS::get_singleton()->get_ticks_msec() - last_reported_mem_usage_ms > 1000) {
@@ -180,7 +225,9 @@ bool TaskManager::BaseTemplateTaskData::wait_for_completion(uint64_t timeout_s_n
 				last_reported_mem_usage_ms = OS::get_singleton()->get_ticks_msec();
 			}
 #endif
-			OS::get_singleton()->delay_usec(10000);
+			if (wait_for_signal(update_interval_usec)) {
+				break;
+			}
 			if (timeout_s_no_progress != 0) {
 				auto curr_progress = get_current_task_step_value();
 				auto curr_time = OS::get_singleton()->get_ticks_msec();
@@ -311,15 +358,17 @@ int TaskManager::DownloadTaskData::get_current_task_step_value() {
 void TaskManager::DownloadTaskData::run_on_current_thread() {
 	if (is_canceled()) {
 		done = true;
+		signal_done();
 		return;
 	}
 	callback_data(nullptr);
 	done = true;
+	signal_done();
 }
 
 void TaskManager::DownloadTaskData::wait_for_task_completion_internal() {
 	while (!is_done()) {
-		OS::get_singleton()->delay_usec(10000);
+		wait_for_signal(get_progress_update_interval_usec());
 	}
 }
 
@@ -330,6 +379,7 @@ bool TaskManager::DownloadTaskData::is_done() const {
 void TaskManager::DownloadTaskData::cancel_internal() {
 	if (!is_started()) {
 		done = true;
+		signal_done();
 	}
 }
 
@@ -6,7 +6,9 @@
 #include "utility/gd_parallel_queue.h"
 #include "utility/gdre_config.h"
 
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 
 struct TaskRunnerStruct {
 	virtual int get_current_task_step_value() = 0;
@@ -25,6 +27,14 @@ public:
 
 	static int64_t maximum_memory_usage;
 
+	// Chunked group tasks (opt-in, for workloads with cheap items) aim for chunks that take about this long to process
+	static constexpr uint64_t CHUNK_TARGET_USEC = 1000;
+	static constexpr int64_t CHUNK_MAX_SIZE = 4096;
+	static constexpr int64_t CHUNK_GUIDED_DIVISOR = 2;
+
+	// How often waiting threads wake up to refresh progress, in microseconds
+	static uint64_t get_progress_update_interval_usec();
+
 	static inline bool is_memory_usage_too_high() {
 		return (int64_t)OS::get_singleton()->get_static_memory_usage() > TaskManager::maximum_memory_usage;
 	}
@@ -39,6 +49,19 @@ public:
 		bool timed_out = false;
 		bool _aborted = false;
 		Ref<EditorProgressGDDC> progress;
+		// last formatted step description; only re-formatted once per progress refresh interval
+		String sampled_description;
+
+		std::mutex signal_mutex;
+		std::condition_variable signal_cv;
+		std::atomic<bool> done_signaled = false;
+
+		// Wakes up the waiting thread; called once no more work for this task is running
+		void signal_done();
+		// Wakes up the waiting thread without marking the task as done (e.g. on start or cancel)
+		void notify_waiter();
+		// Blocks until the task signals completion or the timeout elapses; returns true if completion was signaled
+		bool wait_for_signal(uint64_t p_timeout_usec);
 
 		virtual void wait_for_task_completion_internal() = 0;
 		virtual void start_internal() = 0;
@@ -88,7 +111,12 @@ public:
 		WorkerThreadPool::TaskID task_id = WorkerThreadPool::TaskID(-1);
 		std::atomic<int64_t> last_completed = 0;
 		std::atomic<int64_t> tasks_busy_waiting = 0;
+		// next element to be claimed by a worker in chunked mode
+		std::atomic<int64_t> next_index = 0;
+		// pool callbacks that haven't returned yet; the last one to finish signals completion
+		std::atomic<int64_t> callbacks_remaining = 0;
 		int progress_start = 0;
+		bool chunked = false;
 
 	public:
 		GroupTaskData(
@@ -105,7 +133,8 @@ public:
 				bool p_runs_current_thread = false,
 				bool p_progress_enabled = true,
 				Ref<EditorProgressGDDC> p_progress = nullptr,
-				int p_progress_start = 0) :
+				int p_progress_start = 0,
+				bool p_chunked = false) :
 				instance(p_instance),
 				method(p_method),
 				userdata(p_userdata),
@@ -116,7 +145,8 @@ public:
 				description(p_description),
 				can_cancel(p_can_cancel),
 				high_priority(p_high_priority),
-				progress_start(p_progress_start) {
+				progress_start(p_progress_start),
+				chunked(p_chunked) {
 			progress_enabled = p_progress_enabled;
 			progress = p_progress;
 			runs_current_thread = p_runs_current_thread;
@@ -136,9 +166,15 @@ public:
 			if (runs_current_thread) {
 				// random group id
 				group_id = abs(rand());
+			} else if (tasks != 1 && chunked && elements > tasks) {
+				// one callback per worker; each one claims ranges of elements until there are none left
+				callbacks_remaining = tasks;
+				group_id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GroupTaskData::chunked_task_callback, userdata, tasks, tasks, high_priority, task);
 			} else if (tasks != 1) {
+				callbacks_remaining = elements;
 				group_id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GroupTaskData::group_task_callback, userdata, elements, tasks, high_priority, task);
 			} else {
+				callbacks_remaining = 1;
 				task_id = WorkerThreadPool::get_singleton()->add_template_task(this, &GroupTaskData::regular_task_callback, userdata, high_priority, task);
 			}
 			if (progress_enabled && progress.is_null()) {
@@ -146,11 +182,8 @@ public:
 			}
 		}
 
-		bool group_task_callback(uint32_t p_index, U p_userdata) {
-			if (unlikely(canceled)) {
-				return true;
-			}
-			// if we're using too much memory, wait until it goes down
+		// if we're using too much memory, wait until it goes down
+		inline void wait_for_memory_usage() {
 			if (unlikely(is_memory_usage_too_high())) {
 				tasks_busy_waiting++;
 				while (is_memory_usage_too_high()) {
@@ -162,17 +195,64 @@ public:
 				}
 				tasks_busy_waiting--;
 			}
+		}
+
+		inline void finish_callback() {
+			if (--callbacks_remaining == 0) {
+				signal_done();
+			}
+		}
+
+		bool process_element(uint32_t p_index, U p_userdata) {
+			if (unlikely(canceled)) {
+				return true;
+			}
+			wait_for_memory_usage();
 			(instance->*method)(p_index, p_userdata);
 			last_completed++;
 			return false;
 		}
 
+		void group_task_callback(uint32_t p_index, U p_userdata) {
+			process_element(p_index, p_userdata);
+			finish_callback();
+		}
+
+		// Guided self-scheduling: a worker never claims more than its share of what's left, and grows/shrinks its
+		// chunk size based on how long the last chunk took, so cheap items get batched and expensive ones don't.
+		void chunked_task_callback(uint32_t p_worker, U p_userdata) {
+			int64_t chunk_size = 1;
+			while (likely(!canceled)) {
+				wait_for_memory_usage();
+				int64_t remaining = elements - next_index.load(std::memory_order_relaxed);
+				int64_t claim = CLAMP(remaining / (CHUNK_GUIDED_DIVISOR * tasks), (int64_t)1, chunk_size);
+				int64_t start = next_index.fetch_add(claim);
+				if (start >= elements) {
+					break;
+				}
+				int64_t end = MIN(start + claim, (int64_t)elements);
+				uint64_t chunk_start_usec = OS::get_singleton()->get_ticks_usec();
+				for (int64_t i = start; i < end; i++) {
+					(instance->*method)((uint32_t)i, p_userdata);
+				}
+				uint64_t chunk_usec = OS::get_singleton()->get_ticks_usec() - chunk_start_usec;
+				last_completed += end - start;
+				if (chunk_usec < CHUNK_TARGET_USEC && chunk_size < CHUNK_MAX_SIZE) {
+					chunk_size *= 2;
+				} else if (chunk_usec > CHUNK_TARGET_USEC * 2 && chunk_size > 1) {
+					chunk_size /= 2;
+				}
+			}
+			finish_callback();
+		}
+
 		void regular_task_callback(U p_userdata) {
 			for (int i = 0; i < elements; i++) {
-				if (group_task_callback(i, p_userdata)) {
-					return;
+				if (process_element(i, p_userdata)) {
+					break;
 				}
 			}
+			finish_callback();
 		}
 
 		bool is_done() const override {
@@ -196,7 +276,7 @@ public:
 			}
 			uint64_t last_progress_upd = OS::get_singleton()->get_ticks_usec();
 			for (int i = 0; i < elements; i++) {
-				if (group_task_callback(i, userdata) || OS::get_singleton()->get_ticks_usec() - last_progress_upd > 50000) {
+				if (process_element(i, userdata) || OS::get_singleton()->get_ticks_usec() - last_progress_upd > 50000) {
 					if (update_progress()) {
 						break;
 					}
@@ -263,6 +343,7 @@ public:
 		void run_internal(void *p_data) {
 			cb_struct->run(p_data);
 			done = true;
+			signal_done();
 		}
 		virtual void run_on_current_thread() override {
 			if (canceled) {
@@ -383,7 +464,8 @@ public:
 			bool p_high_priority = true,
 			Ref<EditorProgressGDDC> p_preexisting_progress = nullptr,
 			int p_progress_start = 0,
-			bool p_show_progress = true) {
+			bool p_show_progress = true,
+			bool p_chunked = false) {
 		ERR_FAIL_COND_V_MSG(p_elements == 0, -1, "Task has 0 elements, this is not allowed!");
 		bool is_singlethreaded = GDREConfig::get_singleton()->get_setting("force_single_threaded", false);
 		if (p_tasks <= 0) {
@@ -395,7 +477,7 @@ public:
 		auto task = std::make_shared<GroupTaskData<C, M, U, R>>(
 				p_instance, p_method, p_userdata, p_elements, p_task_step_callback, p_task, p_label, p_can_cancel, p_tasks, p_high_priority,
 				is_singlethreaded,
-				p_show_progress, p_preexisting_progress, p_progress_start);
+				p_show_progress, p_preexisting_progress, p_progress_start, p_chunked);
 		task->start();
 		auto group_id = ++current_task_id;
 		bool already_exists = false;
@@ -420,9 +502,10 @@ public:
 			bool p_high_priority = true,
 			Ref<EditorProgressGDDC> p_preexisting_progress = nullptr,
 			int p_progress_start = 0,
-			bool p_show_progress = true) {
+			bool p_show_progress = true,
+			bool p_chunked = false) {
 		ERR_FAIL_COND_V_MSG(p_elements == 0, ERR_INVALID_PARAMETER, "Task has 0 elements, this is not allowed!");
-		auto task_id = add_group_task(p_instance, p_method, p_userdata, p_elements, p_task_step_callback, p_task, p_label, p_can_cancel, p_tasks, p_high_priority, p_preexisting_progress, p_progress_start, p_show_progress);
+		auto task_id = add_group_task(p_instance, p_method, p_userdata, p_elements, p_task_step_callback, p_task, p_label, p_can_cancel, p_tasks, p_high_priority, p_preexisting_progress, p_progress_start, p_show_progress, p_chunked);
 		return wait_for_task_completion(task_id);
 	}
 